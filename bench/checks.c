@@ -0,0 +1,534 @@
+/* bench/checks.c
+
+   Checks for bugs that have been fixed, so they stay fixed.  Each check
+   prints its name before it starts, then ok or FAILED with what went
+   wrong, and the program exits with 1 if any of them failed.  A check
+   that never finishes is one that failed by hanging.
+
+   Build and run it from the top of the tree with something like:
+
+     cc -O2 -DPARLAY_USE_MINIXML=0 -I. $(pkg-config --cflags freetype2) \
+         parlay.c bench/checks.c $(pkg-config --libs freetype2) -lm \
+         -lpthread -o bench-checks
+     ./bench-checks /path/to/font.ttf
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parlay.h"
+
+
+typedef struct {
+    const char* name;
+    const char* (*run)(void);
+} Check;
+
+
+static void set_up(ParlayStyle* style, ParlayControl* ctl) {
+    parlay_style_defaults(style);
+    style->font_name = "check";
+    style->font_size = 16;
+    style->text_color[0] = 1.0f;
+    style->text_color[1] = 1.0f;
+    style->text_color[2] = 1.0f;
+    style->text_color[3] = 1.0f;
+    parlay_control_defaults(ctl);
+    ctl->background_color[3] = 1.0f;
+}
+
+
+// Preloading clamps the ends of the ranges to the last code point, and
+// used to take a last past INT_MAX as -1, and never stop
+
+static const char* check_preload_huge_range(void) {
+    ParlayCodepointRange ranges[3];
+    ParlayStyle style;
+    ParlayControl ctl;
+
+    set_up(&style,&ctl);
+    ranges[0].first = 0x10FFF0;
+    ranges[0].last = 0xFFFFFFFFul;
+    ranges[1].first = 0x110000;
+    ranges[1].last = (unsigned long)-1;
+    ranges[2].first = 'a';
+    ranges[2].last = 'z';
+    if (parlay_preload_glyphs(&style,ranges,3)) {
+        return "preloading failed";
+    }
+    return NULL;
+}
+
+
+// font_handle is only looked at when font_name is NULL, so garbage in it
+// can't take the place of the name, which it used to
+
+static const char* check_font_name_wins(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage image;
+    ParlayFontHandle handle;
+
+    set_up(&style,&ctl);
+    style.font_handle = 12345;
+    if (parlay_plain_text("Handle",&style,&ctl,&image)) {
+        return "a garbage handle made rendering by name fail";
+    }
+    parlay_free_image_data(&image);
+    if (parlay_get_font_handle("check",&handle)) {
+        return "can't get the handle";
+    }
+    style.font_name = NULL;
+    style.font_handle = handle;
+    if (parlay_plain_text("Handle",&style,&ctl,&image)) {
+        return "rendering by handle failed";
+    }
+    parlay_free_image_data(&image);
+    return NULL;
+}
+
+
+// Anything but PARLAY_BREAK_OPTIMAL breaks lines greedily, instead of
+// failing with 1406 as it used to
+
+static const char* check_line_breaking_garbage(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage greedy, garbage;
+    const char* text = "A paragraph long enough to wrap onto a few lines at the width it's given.";
+    const char* failure = NULL;
+
+    set_up(&style,&ctl);
+    ctl.width = 150;
+    if (parlay_plain_text(text,&style,&ctl,&greedy)) {
+        return "greedy breaking failed";
+    }
+    ctl.line_breaking = 12345;
+    if (parlay_plain_text(text,&style,&ctl,&garbage)) {
+        failure = "breaking with garbage in line_breaking failed";
+    } else {
+        if (garbage.width != greedy.width || garbage.height != greedy.height
+                || memcmp(garbage.data,greedy.data,greedy.width*greedy.height*4)) {
+            failure = "garbage in line_breaking didn't break greedily";
+        }
+        parlay_free_image_data(&garbage);
+    }
+    parlay_free_image_data(&greedy);
+    return failure;
+}
+
+
+// Anything but the other two border methods smears, instead of failing
+// with 1210 as it used to
+
+static const char* check_border_method_garbage(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage smear, garbage;
+    const char* failure = NULL;
+
+    set_up(&style,&ctl);
+    style.border_thickness = 2;
+    style.border_color[3] = 1.0f;
+    if (parlay_plain_text("Bordered",&style,&ctl,&smear)) {
+        return "smearing failed";
+    }
+    style.border_method = 12345;
+    if (parlay_plain_text("Bordered",&style,&ctl,&garbage)) {
+        failure = "bordering with garbage in border_method failed";
+    } else {
+        if (garbage.width != smear.width || garbage.height != smear.height
+                || memcmp(garbage.data,smear.data,smear.width*smear.height*4)) {
+            failure = "garbage in border_method didn't smear";
+        }
+        parlay_free_image_data(&garbage);
+    }
+    parlay_free_image_data(&smear);
+    return failure;
+}
+
+
+// Renders first underlined or not, then second (if there is one) not
+// underlined, with a builder, copying the image out of it
+
+static int render_pieces(const char* first, const char* second, int underline, ParlayRGBARawImage* image) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayParagraphBuilder* builder;
+    ParlayRGBARawImage built;
+    size_t size;
+    int status, dirty_y, dirty_height;
+
+    set_up(&style,&ctl);
+    ctl.width = 300;
+    if ((status = parlay_builder_new(&ctl,&builder)) != 0) {
+        return status;
+    }
+    style.underline = underline;
+    status = parlay_builder_append_text(builder,first,&style);
+    style.underline = 0;
+    if (status == 0 && second != NULL) {
+        status = parlay_builder_append_text(builder,second,&style);
+    }
+    if (status == 0) {
+        status = parlay_builder_render(builder,&built,&dirty_y,&dirty_height);
+    }
+    if (status == 0) {
+        size = built.width*built.height*4;
+        *image = built;
+        if ((image->data = (unsigned char*)malloc(size)) == NULL) {
+            status = 6;
+        } else {
+            memcpy(image->data,built.data,size);
+        }
+    }
+    parlay_builder_delete(builder);
+    return status;
+}
+
+
+static int rightmost_difference(const ParlayRGBARawImage* a, const ParlayRGBARawImage* b) {
+    size_t i, j;
+    int right = -1;
+    for (j = 0; j < a->height; j++) {
+        for (i = (size_t)(right+1); i < a->width; i++) {
+            if (memcmp(a->data+(j*a->width+i)*4,b->data+(j*b->width+i)*4,4)) {
+                right = (int)i;
+            }
+        }
+    }
+    return right;
+}
+
+
+// Every line of a wrapped underlined paragraph is underlined from one end
+// to the other.  A run of underlining used to end under the glyph after
+// it, which on every line but the last is the first glyph of the next
+// line, so those lines only got a stub.
+
+static const char* check_wrapped_underline(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayTextMetrics metrics;
+    ParlayRGBARawImage plain, underlined;
+    const ParlayLineExtent* line;
+    const char* text = "A paragraph long enough to wrap onto a few lines at the width it's given.";
+    const char* failure = NULL;
+    size_t l, i, j;
+    int left, right;
+
+    set_up(&style,&ctl);
+    ctl.width = 150;
+    if (parlay_measure_text(text,&style,&ctl,&metrics)) {
+        return "measuring failed";
+    }
+    if (parlay_plain_text(text,&style,&ctl,&plain)) {
+        parlay_free_text_metrics(&metrics);
+        return "rendering without underlines failed";
+    }
+    style.underline = 1;
+    if (parlay_plain_text(text,&style,&ctl,&underlined)) {
+        failure = "rendering with underlines failed";
+    } else if (underlined.width != plain.width || underlined.height != plain.height) {
+        failure = "underlining changed the size of the image";
+    } else if (metrics.n_lines < 2) {
+        failure = "the paragraph didn't wrap";
+    } else {
+        // The underline is where the two images differ.  It stops short of
+        // a space at the end of the line, but not by much.
+        for (l = 0; l < metrics.n_lines && failure == NULL; l++) {
+            line = &metrics.lines[l];
+            left = (int)plain.width;
+            right = -1;
+            for (j = (size_t)line->y; j < (size_t)(line->y + line->height) && j < plain.height; j++) {
+                for (i = 0; i < plain.width; i++) {
+                    if (memcmp(plain.data+(j*plain.width+i)*4,underlined.data+(j*plain.width+i)*4,4)) {
+                        left = (int)i < left ? (int)i : left;
+                        right = (int)i > right ? (int)i : right;
+                    }
+                }
+            }
+            if (right < 0) {
+                failure = "a line wasn't underlined";
+            } else if (right - left + 1 < line->width * 9 / 10) {
+                failure = "a line was only partly underlined";
+            }
+        }
+    }
+    parlay_free_image_data(&underlined);
+    parlay_free_image_data(&plain);
+    parlay_free_text_metrics(&metrics);
+    return failure;
+}
+
+
+// A run of underlining ends under its last glyph, whatever comes after it.
+// It used to go on under the next glyph that wasn't underlined.
+
+static const char* check_underline_end(void) {
+    ParlayRGBARawImage images[4];
+    const char* failure = NULL;
+    int i, alone, followed;
+
+    memset(images,0,sizeof(images));
+    if (render_pieces("Under",NULL,0,&images[0]) || render_pieces("Under",NULL,1,&images[1])
+            || render_pieces("Under","mine",0,&images[2]) || render_pieces("Under","mine",1,&images[3])) {
+        failure = "rendering failed";
+    } else {
+        alone = rightmost_difference(&images[0],&images[1]);
+        followed = rightmost_difference(&images[2],&images[3]);
+        if (alone < 0) {
+            failure = "nothing was underlined";
+        } else if (followed != alone) {
+            failure = "the underline went on under the text after it";
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        parlay_free_image_data(&images[i]);
+    }
+    return failure;
+}
+
+
+// Where glyph k of a layout is drawn, found by drawing only it: the
+// leftmost column with any ink, or -1 if it has none
+
+static int glyph_left(ParlayLayout* layout, size_t n_glyphs, size_t k, const ParlayControl* ctl) {
+    ParlayRGBARawImage image;
+    size_t i, j;
+    int left = -1;
+
+    parlay_layout_set_visible(layout,0,n_glyphs,0);
+    parlay_layout_set_visible(layout,k,1,1);
+    if (parlay_layout_render(layout,ctl,&image)) {
+        return -2;
+    }
+    for (i = 0; i < image.width && left < 0; i++) {
+        for (j = 0; j < image.height; j++) {
+            if (image.data[(j*image.width+i)*4] != 0) {
+                left = (int)i;
+                break;
+            }
+        }
+    }
+    parlay_free_image_data(&image);
+    return left;
+}
+
+
+// Brackets are paired, and a pair takes the direction of the text inside
+// it, so in a right-to-left paragraph "(abc)" stays together between the
+// right-to-left text and the number after it.  Resolved like other
+// punctuation, the closing bracket used to go left to right with abc and
+// 12, and the line came out as "ז abc) 12) והד גבא".
+
+static const char* check_bracket_pairs(void) {
+    // The inked glyphs of the text, in the order they should be drawn
+    // from left to right: ז 12 (abc) והד גבא
+    static const size_t expected[] = { 17, 14, 15, 12, 9, 10, 11, 8, 6, 5, 4, 2, 1, 0 };
+    const size_t n_expected = sizeof(expected)/sizeof(expected[0]);
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayLayout* layout;
+    const char* text = "\xd7\x90\xd7\x91\xd7\x92 \xd7\x93\xd7\x94\xd7\x95 (abc) 12 \xd7\x96";
+    const char* failure = NULL;
+    size_t i, n_glyphs;
+    int x, prev_x = -1;
+
+    set_up(&style,&ctl);
+    if (parlay_layout_plain_text(text,&style,&ctl,&layout)) {
+        return "laying out failed";
+    }
+    parlay_layout_get_glyph_count(layout,&n_glyphs);
+    if (n_glyphs != 18) {
+        failure = "the text didn't come to one glyph per character";
+    }
+    for (i = 0; i < n_expected && failure == NULL; i++) {
+        x = glyph_left(layout,n_glyphs,expected[i],&ctl);
+        if (x < 0) {
+            failure = "a glyph didn't draw";
+        } else if (x <= prev_x) {
+            failure = "the line isn't in the order ז 12 (abc) והד גבא";
+        }
+        prev_x = x;
+    }
+    parlay_layout_delete(layout);
+    return failure;
+}
+
+
+// Each line after a hard break is a paragraph of its own, with the
+// direction of its own first letter, so a Hebrew line after an English one
+// is aligned to the right, and the other way around.  The whole text used
+// to take the direction of its first letter.  Line extents are measured
+// from the ink, so the right edges may be a pixel or so apart.
+
+static const char* check_paragraph_directions(void) {
+    static const char* texts[2] = {
+        "Hello world\n\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d",
+        "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d\nHello world",
+    };
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayTextMetrics metrics;
+    const ParlayLineExtent* english;
+    const ParlayLineExtent* hebrew;
+    const char* failure = NULL;
+    int t;
+
+    set_up(&style,&ctl);
+    for (t = 0; t < 2 && failure == NULL; t++) {
+        if (parlay_measure_text(texts[t],&style,&ctl,&metrics)) {
+            return "measuring failed";
+        }
+        if (metrics.n_lines != 2) {
+            failure = "the text isn't two lines";
+        } else {
+            english = &metrics.lines[t];
+            hebrew = &metrics.lines[1-t];
+            if (english->x != 0) {
+                failure = "the English line isn't aligned to the left";
+            } else if (hebrew->x < english->width/2 || abs(hebrew->x + hebrew->width - english->width) > 2) {
+                failure = "the Hebrew line isn't aligned to the right";
+            }
+        }
+        parlay_free_text_metrics(&metrics);
+    }
+    return failure;
+}
+
+
+// A layout draws the same after the glyph cache has been emptied and
+// refilled with other glyphs, since it holds on to the bitmaps it was laid
+// out with; setting a font's fallbacks empties the cache.  It used to fall
+// back to FreeType's caches instead.
+
+static const char* check_layout_outlives_cache(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayLayout* layout;
+    ParlayRGBARawImage before, after, other;
+    const char* failure = NULL;
+    int i;
+
+    set_up(&style,&ctl);
+    if (parlay_layout_plain_text("Cached glyphs",&style,&ctl,&layout)) {
+        return "laying out failed";
+    }
+    if (parlay_layout_render(layout,&ctl,&before)) {
+        parlay_layout_delete(layout);
+        return "rendering failed";
+    }
+    for (i = 0; i < 2 && failure == NULL; i++) {
+        if (parlay_set_font_fallbacks("check",NULL,0)) {
+            failure = "setting fallbacks failed";
+        } else if (parlay_plain_text("Other glyphs, 0123456789",&style,&ctl,&other)) {
+            failure = "rendering other text failed";
+        } else {
+            parlay_free_image_data(&other);
+        }
+    }
+    if (failure == NULL) {
+        if (parlay_layout_render(layout,&ctl,&after)) {
+            failure = "rendering again failed";
+        } else {
+            if (after.width != before.width || after.height != before.height
+                    || memcmp(after.data,before.data,before.width*before.height*4)) {
+                failure = "the layout came out different";
+            }
+            parlay_free_image_data(&after);
+        }
+    }
+    parlay_free_image_data(&before);
+    parlay_layout_delete(layout);
+    return failure;
+}
+
+
+// Text that isn't valid UTF-8 fails with 1205, and the context says why
+// and where, which it used to leave to parlay_check_utf8
+
+static const char* check_utf8_error_offset(void) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage image;
+    ParlayParagraphBuilder* builder;
+    size_t offset;
+    int status;
+
+    set_up(&style,&ctl);
+    if (parlay_plain_text("Fine, then \xed\xa0\x80 not",&style,&ctl,&image) != 1205) {
+        return "a surrogate didn't fail with 1205";
+    }
+    if (parlay_last_utf8_error(&offset) != 2904 || offset != 11) {
+        return "the surrogate wasn't reported at 11";
+    }
+    if (parlay_plain_text("Fine",&style,&ctl,&image)) {
+        return "valid text failed";
+    }
+    parlay_free_image_data(&image);
+    if (parlay_last_utf8_error(&offset) != 0) {
+        return "valid text left an error behind";
+    }
+
+    ctl.width = 200;
+    if (parlay_builder_new(&ctl,&builder)) {
+        return "can't make a builder";
+    }
+    status = parlay_builder_append_text(builder,"First piece. ",&style);
+    if (status == 0) {
+        status = parlay_builder_append_text(builder,"ab\xe2\x82",&style);
+    }
+    parlay_builder_delete(builder);
+    if (status != 1205) {
+        return "a cut short character didn't fail the builder with 1205";
+    }
+    if (parlay_last_utf8_error(&offset) != 2902 || offset != 2) {
+        return "the cut short character wasn't reported at 2 in its piece";
+    }
+    return NULL;
+}
+
+
+static const Check checks[] = {
+    { "preloading a range that ends past the last code point", check_preload_huge_range },
+    { "font_name takes precedence over font_handle", check_font_name_wins },
+    { "line_breaking other than optimal is greedy", check_line_breaking_garbage },
+    { "border_method other than dilate or stroke smears", check_border_method_garbage },
+    { "bad UTF-8 is reported with its offset", check_utf8_error_offset },
+    { "every line of a wrapped paragraph is underlined", check_wrapped_underline },
+    { "underlining ends under the last underlined glyph", check_underline_end },
+    { "brackets take the direction of the text inside them", check_bracket_pairs },
+    { "each line after a hard break has its own direction", check_paragraph_directions },
+    { "a layout draws the same after the glyph cache is emptied", check_layout_outlives_cache },
+};
+
+
+int main(int argc, char** argv) {
+    const char* failure;
+    size_t i;
+    int failed = 0;
+
+    if (argc < 2) {
+        fprintf(stderr,"usage: %s font-file\n",argv[0]);
+        return 1;
+    }
+    if (parlay_init() || parlay_register_font("check",argv[1],argv[1],argv[1],argv[1])) {
+        fprintf(stderr,"can't register %s\n",argv[1]);
+        return 1;
+    }
+
+    for (i = 0; i < sizeof(checks)/sizeof(checks[0]); i++) {
+        printf("%s: ",checks[i].name);
+        fflush(stdout);
+        if ((failure = checks[i].run()) != NULL) {
+            printf("FAILED, %s\n",failure);
+            failed = 1;
+        } else {
+            printf("ok\n");
+        }
+    }
+
+    parlay_finalize();
+    return failed;
+}
@@ -0,0 +1,321 @@
+/* bench/composite.c
+
+   Compares the fixed-point compositor with the float compositor it
+   replaced.  Each paragraph is laid out once, then rendered over and over
+   by parlay_layout_render and by float_rasterize below, which is the old
+   rasterize: a float work buffer four times the size of the image, every
+   pixel blended with divides, converted to bytes at the end, and borders
+   smeared by compositing the glyph once per offset.  It prints the time
+   per render for each and the largest difference between their pixels,
+   with every span kernel the CPU has, and exits with 1 if any pixel is
+   off by more than one.
+
+   The old compositor is reached through Parlay's internals, so this
+   includes parlay.c rather than linking with it.  Build and run it from
+   the top of the tree with something like:
+
+     cc -O2 -DPARLAY_USE_MINIXML=0 -I. $(pkg-config --cflags freetype2) \
+         bench/composite.c $(pkg-config --libs freetype2) -lm -lpthread \
+         -o bench-composite
+     ./bench-composite /path/to/font.ttf
+*/
+
+#include <time.h>
+#include "../parlay.c"
+
+
+static void float_transfer_rect(const ParlayLayout* layout, int x, int y, int width, int height, const float rgb[3],
+        float alpha, float* work) {
+    int i, j, imax, jmax;
+    size_t iw;
+    float source_alpha, rem_alpha, total_alpha;
+
+    imax = (int)MAX(0,MIN(width,layout->width-x));
+    jmax = (int)MAX(0,MIN(height,layout->height-y));
+    for (i = MAX(0,-x); i < imax; i++) {
+        for (j = MAX(0,-y); j < jmax; j++) {
+            iw = ((size_t)(y+j) * layout->width + (x+i)) * 4;
+            source_alpha = alpha;
+            rem_alpha = (1-source_alpha)*work[iw+3];
+            total_alpha = source_alpha + rem_alpha;
+            source_alpha /= total_alpha;
+            rem_alpha /= total_alpha;
+            work[iw+0] = rgb[0]*source_alpha + work[iw+0]*rem_alpha;
+            work[iw+1] = rgb[1]*source_alpha + work[iw+1]*rem_alpha;
+            work[iw+2] = rgb[2]*source_alpha + work[iw+2]*rem_alpha;
+            work[iw+3] = total_alpha;
+        }
+    }
+}
+
+
+static void float_transfer_buffer(const ParlayLayout* layout, const unsigned char* buffer, int x, int y, int width,
+        int height, const float rgb[3], float alpha, float* work) {
+    int i, j, imax, jmax;
+    size_t ig, iw;
+    float source_alpha, rem_alpha, total_alpha;
+
+    imax = (int)MAX(0,MIN(width,layout->width-x));
+    jmax = (int)MAX(0,MIN(height,layout->height-y));
+    for (i = MAX(0,-x); i < imax; i++) {
+        for (j = MAX(0,-y); j < jmax; j++) {
+            ig = (size_t)j * width + i;
+            if (buffer[ig] != 0) {
+                iw = ((size_t)(y+j) * layout->width + (x+i)) * 4;
+                source_alpha = (buffer[ig]/255.0f) * alpha;
+                rem_alpha = (1-source_alpha)*work[iw+3];
+                total_alpha = source_alpha + rem_alpha;
+                source_alpha /= total_alpha;
+                rem_alpha /= total_alpha;
+                work[iw+0] = rgb[0]*source_alpha + work[iw+0]*rem_alpha;
+                work[iw+1] = rgb[1]*source_alpha + work[iw+1]*rem_alpha;
+                work[iw+2] = rgb[2]*source_alpha + work[iw+2]*rem_alpha;
+                work[iw+3] = total_alpha;
+            }
+        }
+    }
+}
+
+
+static void float_smear_buffer(const ParlayLayout* layout, const unsigned char* buffer, int x, int y, int width,
+        int height, const float rgb[3], float alpha, int bt, float* work) {
+    int i, j;
+    float r;
+    for (i = -bt; i <= bt; i++) {
+        for (j = -bt; j <= bt; j++) {
+            r = (float)sqrt(i*i+j*j);
+            if (r <= bt) {
+                float_transfer_buffer(layout,buffer,x+i,y+j,width,height,rgb,alpha,work);
+            } else if (r <= bt+1) {
+                float_transfer_buffer(layout,buffer,x+i,y+j,width,height,rgb,alpha*(bt+1-r),work);
+            }
+        }
+    }
+}
+
+
+// The old rasterize, less underlines, into a buffer the caller allocates
+
+static int float_rasterize(ParlayContext* ctx, const ParlayLayout* layout, const float background_color[4],
+        float* work, unsigned char* data) {
+    const ParlayGlyphPlan* gp;
+    FTC_ScalerRec face_size_info;
+    FTC_SBit sbit;
+    FT_BitmapGlyph glyph;
+    const unsigned char* c_buffer;
+    size_t k, m, n = (size_t)layout->width * layout->height * 4;
+    int x, y;
+
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+
+    for (k = 0; k < n; k++) {
+        work[k] = background_color[k%4];
+    }
+    if (layout->any_highlights) {
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            if (!gp->highlight) {
+                continue;
+            }
+            y = layout->y_image_offset - (gp->y + gp->ascender);
+            x = gp->x - layout->x_image_offset;
+            float_transfer_rect(layout,x,y,gp->advance,gp->line_height,gp->highlight_color,gp->highlight_color[3],work);
+        }
+    }
+    for (m = layout->any_borders ? 0 : 1; m < 2; m++) {
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            if (gp->face_id == NULL) {
+                continue;
+            }
+            face_size_info.face_id = gp->face_id;
+            face_size_info.width = gp->font_px;
+            face_size_info.height = gp->font_px;
+            if (gp->is_sbit) {
+                if (FTC_SBitCache_LookupScaler(ctx->sbit_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,&sbit,NULL)) {
+                    return 1;
+                }
+                c_buffer = sbit->buffer;
+            } else {
+                if (FTC_ImageCache_LookupScaler(ctx->image_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,
+                        (FT_Glyph*)&glyph,NULL)) {
+                    return 1;
+                }
+                c_buffer = glyph->bitmap.buffer;
+            }
+            y = layout->y_image_offset - (gp->y + gp->top);
+            x = (gp->x + gp->left) - layout->x_image_offset;
+            if (m == 0) {
+                if (gp->border_thickness != 0) {
+                    float_smear_buffer(layout,c_buffer,x,y,gp->width,gp->height,gp->border_color,gp->border_color[3],
+                            gp->border_thickness,work);
+                }
+            } else {
+                float_transfer_buffer(layout,c_buffer,x,y,gp->width,gp->height,gp->text_color,gp->text_color[3],work);
+            }
+        }
+    }
+    for (k = 0; k < n; k++) {
+        data[k] = (unsigned char)(work[k] * 255.0);
+    }
+    return 0;
+}
+
+
+typedef struct {
+    const char* name;
+    float font_size;
+    float text_alpha;
+    float background_alpha;
+    int border_thickness;
+    int highlight;
+} Config;
+
+
+typedef struct {
+    const char* name;
+    BlendSpanFunction blend_span;
+} Kernel;
+
+
+// The largest difference between two renders of the same size.  Clear pixels
+// have no color, so only their alpha is compared.
+
+static int max_difference(const unsigned char* a, const unsigned char* b, size_t n) {
+    size_t k;
+    int diff, max_diff = 0;
+    for (k = 0; k < n; k++) {
+        if (k%4 != 3 && a[k|3] == 0 && b[k|3] == 0) {
+            continue;
+        }
+        diff = abs((int)a[k] - (int)b[k]);
+        if (diff > max_diff) {
+            max_diff = diff;
+        }
+    }
+    return max_diff;
+}
+
+
+int main(int argc, char** argv) {
+    static const Config configs[] = {
+        { "plain, opaque background", 16, 0.9f, 1.0f, 0, 0 },
+        { "plain, clear background", 16, 0.9f, 0.0f, 0, 0 },
+        { "border 2", 16, 0.9f, 1.0f, 2, 0 },
+        { "border 4 and highlight", 16, 0.9f, 1.0f, 4, 1 },
+        { "border 3, all translucent", 16, 0.6f, 0.5f, 3, 1 },
+        { "border 2, clear background", 16, 0.6f, 0.0f, 2, 1 },
+        { "48px, border 3", 48, 0.9f, 1.0f, 3, 0 },
+    };
+    Kernel kernels[3];
+    const char* text = "Parlay lays out paragraphs of text and renders them to an RGBA image in memory. "
+        "This one is about as long as a tooltip or a few lines of dialog in a game, which is "
+        "the sort of text it was written for, wrapped to three hundred pixels.";
+    ParlayContext* ctx = NULL;
+    ParlayLayout* layout;
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage image;
+    float* work;
+    unsigned char* data;
+    size_t c, n, n_kernels = 0, q;
+    int i, runs = 50, max_diff, failed = 0;
+    clock_t t0, t1, t2;
+
+    if (argc < 2) {
+        fprintf(stderr,"usage: %s font-file\n",argv[0]);
+        return 1;
+    }
+    if (parlay_context_new(0,0,0,&ctx) || parlay_context_register_font(ctx,"bench",argv[1],NULL,NULL,NULL)) {
+        fprintf(stderr,"can't set up a context with %s\n",argv[1]);
+        return 1;
+    }
+    kernels[n_kernels].name = "scalar";
+    kernels[n_kernels++].blend_span = blend_span_scalar;
+#if PARLAY_SIMD_X86
+    if (cpu_has_sse2()) {
+        kernels[n_kernels].name = "SSE2";
+        kernels[n_kernels++].blend_span = blend_span_sse2;
+    }
+    if (cpu_has_avx2()) {
+        kernels[n_kernels].name = "AVX2";
+        kernels[n_kernels++].blend_span = blend_span_avx2;
+    }
+#elif PARLAY_SIMD_NEON
+    kernels[n_kernels].name = "NEON";
+    kernels[n_kernels++].blend_span = blend_span_neon;
+#endif
+
+    for (c = 0; c < sizeof(configs)/sizeof(configs[0]); c++) {
+        parlay_style_defaults(&style);
+        style.font_name = "bench";
+        style.font_size = configs[c].font_size;
+        style.text_color[0] = 0.1f;
+        style.text_color[3] = configs[c].text_alpha;
+        style.border_thickness = configs[c].border_thickness;
+        style.border_color[0] = 1.0f;
+        style.border_color[1] = 0.8f;
+        style.border_color[3] = 0.7f;
+        style.highlight = configs[c].highlight;
+        style.highlight_color[1] = 1.0f;
+        style.highlight_color[3] = 0.5f;
+        parlay_control_defaults(&ctl);
+        ctl.width = 300;
+        ctl.background_color[0] = 0.2f;
+        ctl.background_color[2] = 0.4f;
+        ctl.background_color[3] = configs[c].background_alpha;
+
+        if (parlay_context_layout_plain_text(ctx,text,&style,&ctl,&layout)) {
+            fprintf(stderr,"%s: layout failed\n",configs[c].name);
+            return 1;
+        }
+        n = (size_t)layout->width * layout->height * 4;
+        work = (float*)malloc(n * sizeof(float));
+        data = (unsigned char*)malloc(n);
+        if (work == NULL || data == NULL || float_rasterize(ctx,layout,ctl.background_color,work,data)) {
+            fprintf(stderr,"%s: float render failed\n",configs[c].name);
+            return 1;
+        }
+
+        max_diff = 0;
+        for (q = 0; q < n_kernels; q++) {
+            ctx->blend_span = kernels[q].blend_span;
+            memset(&image,0,sizeof(image));
+            if (parlay_layout_render(layout,&ctl,&image)) {
+                fprintf(stderr,"%s: render failed\n",configs[c].name);
+                return 1;
+            }
+            i = max_difference(image.data,data,n);
+            if (i > 1) {
+                printf("%-26s %s kernel is off by %d\n",configs[c].name,kernels[q].name,i);
+                failed = 1;
+            }
+            max_diff = MAX(max_diff,i);
+            parlay_free_image_data(&image);
+        }
+        ctx->blend_span = select_blend_span();
+
+        t0 = clock();
+        for (i = 0; i < runs; i++) {
+            float_rasterize(ctx,layout,ctl.background_color,work,data);
+        }
+        t1 = clock();
+        for (i = 0; i < runs; i++) {
+            parlay_layout_render(layout,&ctl,&image);
+            parlay_free_image_data(&image);
+        }
+        t2 = clock();
+
+        printf("%-26s float %7.2f ms  fixed %7.2f ms  max difference %d\n",configs[c].name,
+                (double)(t1-t0)*1000.0/CLOCKS_PER_SEC/runs,(double)(t2-t1)*1000.0/CLOCKS_PER_SEC/runs,max_diff);
+
+        free(work);
+        free(data);
+        parlay_layout_delete(layout);
+    }
+
+    parlay_context_delete(ctx);
+    return failed;
+}
@@ -0,0 +1,172 @@
+/* bench/kerning.c
+
+   Times a long paragraph with kerning off and on.  The paragraph is made
+   of random lorem ipsum words, about as many characters as asked for,
+   laid out at 16 pixels and wrapped to 600.  Each is measured with
+   parlay_measure_text, which only lays out, and rendered with
+   parlay_plain_text, and for comparison it also times looking up the
+   same pairs straight from FreeType, with no cache, which is what every
+   kerned glyph would cost otherwise.  It prints the time per run for
+   each, and how many lines kerning changed the width of.
+
+   Build and run it from the top of the tree with something like:
+
+     cc -O2 -DPARLAY_USE_MINIXML=0 -I. $(pkg-config --cflags freetype2) \
+         parlay.c bench/kerning.c $(pkg-config --libs freetype2) -lm -lpthread \
+         -o bench-kerning
+     ./bench-kerning /path/to/font.ttf [characters]
+
+   Use a font with a 'kern' table, or both runs come out the same.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "parlay.h"
+
+
+static char* make_paragraph(size_t n) {
+    static const char* words[] = {
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do",
+        "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua", "enim",
+        "ad", "minim", "veniam", "quis", "nostrud", "exercitation", "ullamco", "laboris", "nisi", "aliquip",
+        "Tower", "AVAIL", "Yawning", "Wave", "LATTE", "Tyrant", "Vow", "Fjord",
+    };
+    const size_t n_words = sizeof(words)/sizeof(words[0]);
+    char* text = (char*)malloc(n + 32);
+    size_t len = 0;
+    unsigned r = 1;
+
+    if (text == NULL) {
+        return NULL;
+    }
+    text[0] = '\0';
+    while (len < n) {
+        r = r * 1103515245 + 12345;
+        len += sprintf(text+len,"%s ",words[(r>>16) % n_words]);
+    }
+    return text;
+}
+
+
+// What kerning costs without Parlay's pair cache: a glyph lookup and an
+// FT_Get_Kerning call for every pair of letters
+
+static long kern_uncached(FT_Face face, const char* text) {
+    FT_Vector delta;
+    FT_UInt left = 0, right;
+    long total = 0;
+    const char* p;
+
+    for (p = text; *p != '\0'; p++) {
+        if (*p == ' ') {
+            left = 0;
+            continue;
+        }
+        right = FT_Get_Char_Index(face,(unsigned char)*p);
+        if (left != 0 && !FT_Get_Kerning(face,left,right,FT_KERNING_DEFAULT,&delta)) {
+            total += delta.x;
+        }
+        left = right;
+    }
+    return total;
+}
+
+
+static double seconds(clock_t t0, clock_t t1) {
+    return (double)(t1-t0) / CLOCKS_PER_SEC;
+}
+
+
+int main(int argc, char** argv) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayTextMetrics metrics[2];
+    ParlayRGBARawImage image;
+    FT_Library library;
+    FT_Face face;
+    size_t n = 16000, l;
+    char* text;
+    int i, kerning, runs = 20, moved;
+    long total = 0;
+    clock_t t0, t1, t2;
+
+    if (argc < 2) {
+        fprintf(stderr,"usage: %s font-file [characters]\n",argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        n = (size_t)atol(argv[2]);
+    }
+    if (parlay_init() || parlay_register_font("bench",argv[1],NULL,NULL,NULL)) {
+        fprintf(stderr,"can't register %s\n",argv[1]);
+        return 1;
+    }
+    if ((text = make_paragraph(n)) == NULL) {
+        return 1;
+    }
+
+    parlay_style_defaults(&style);
+    style.font_name = "bench";
+    style.font_size = 16;
+    parlay_control_defaults(&ctl);
+    ctl.width = 600;
+    ctl.background_color[3] = 1.0f;
+    printf("%u characters, %d px wide, %d runs each\n",(unsigned)strlen(text),ctl.width,runs);
+
+    for (kerning = 0; kerning < 2; kerning++) {
+        ctl.kerning = kerning ? PARLAY_KERNING_ON : PARLAY_KERNING_OFF;
+        t0 = clock();
+        for (i = 0; i < runs; i++) {
+            if (i > 0) {
+                parlay_free_text_metrics(&metrics[kerning]);
+            }
+            if (parlay_measure_text(text,&style,&ctl,&metrics[kerning])) {
+                fprintf(stderr,"measuring failed\n");
+                return 1;
+            }
+        }
+        t1 = clock();
+        for (i = 0; i < runs; i++) {
+            if (parlay_plain_text(text,&style,&ctl,&image)) {
+                fprintf(stderr,"rendering failed\n");
+                return 1;
+            }
+            parlay_free_image_data(&image);
+        }
+        t2 = clock();
+        printf("%-9s measure %7.2f ms  render %7.2f ms  %u lines\n",kerning ? "kerned" : "unkerned",
+                seconds(t0,t1)*1000.0/runs,seconds(t1,t2)*1000.0/runs,(unsigned)metrics[kerning].n_lines);
+    }
+
+    if (FT_Init_FreeType(&library) || FT_New_Face(library,argv[1],0,&face)) {
+        fprintf(stderr,"FreeType can't open %s\n",argv[1]);
+        return 1;
+    }
+    FT_Set_Pixel_Sizes(face,16,16);
+    t0 = clock();
+    for (i = 0; i < runs; i++) {
+        total += kern_uncached(face,text);
+    }
+    t1 = clock();
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    printf("the same pairs from FreeType, uncached: %.2f ms\n",seconds(t0,t1)*1000.0/runs);
+
+    // Kerning usually pulls letters together, so lines get shorter
+    moved = 0;
+    for (l = 0; l < metrics[0].n_lines && l < metrics[1].n_lines; l++) {
+        moved += metrics[0].lines[l].width != metrics[1].lines[l].width;
+    }
+    printf("%d of %u lines changed width (total kerning %ld/64 px per run)\n",moved,
+            (unsigned)metrics[0].n_lines,total/runs);
+
+    parlay_free_text_metrics(&metrics[0]);
+    parlay_free_text_metrics(&metrics[1]);
+    free(text);
+    parlay_finalize();
+    return 0;
+}
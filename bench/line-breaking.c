@@ -0,0 +1,141 @@
+/* bench/line-breaking.c
+
+   Compares greedy and optimal line breaking on long paragraphs.  Each
+   paragraph is random lorem ipsum words, with now and then a word too
+   long to fit comfortably, about as many characters as asked for, laid
+   out at 16 pixels.  For each wrap width and each way of breaking, it
+   prints the number of lines, how ragged they are (the sum of the
+   squares of the space left at the end of each line but the last), how
+   many lines are wider than the wrap width, and the time per run to
+   measure the paragraph with parlay_measure_text, which only lays out,
+   and to render it with parlay_plain_text.  Lines are wrapped by their
+   glyphs' advances, but measured by their ink, so a line that ends in a
+   letter that overhangs its advance can come out a pixel or two over;
+   those are counted as overfull, and not as slack.
+
+   Build and run it from the top of the tree with something like:
+
+     cc -O2 -DPARLAY_USE_MINIXML=0 -I. $(pkg-config --cflags freetype2) \
+         parlay.c bench/line-breaking.c $(pkg-config --libs freetype2) -lm \
+         -lpthread -o bench-line-breaking
+     ./bench-line-breaking /path/to/font.ttf [characters]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "parlay.h"
+
+
+static char* make_paragraph(size_t n) {
+    static const char* words[] = {
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit", "sed", "do",
+        "eiusmod", "tempor", "incididunt", "ut", "labore", "et", "dolore", "magna", "aliqua", "enim",
+        "ad", "minim", "veniam", "quis", "nostrud", "exercitation", "ullamco", "laboris", "nisi", "aliquip",
+    };
+    const size_t n_words = sizeof(words)/sizeof(words[0]);
+    const char* long_word = "Supercalifragilisticexpialidociousandthensomemoreletters";
+    char* text = (char*)malloc(n + 128);
+    size_t len = 0;
+    unsigned r = 1;
+
+    if (text == NULL) {
+        return NULL;
+    }
+    text[0] = '\0';
+    while (len < n) {
+        r = r * 1103515245 + 12345;
+        len += sprintf(text+len,"%s ",words[(r>>16) % n_words]);
+        if ((r>>8) % 97 == 0) {
+            len += sprintf(text+len,"%s ",long_word);
+        }
+    }
+    return text;
+}
+
+
+static double seconds(clock_t t0, clock_t t1) {
+    return (double)(t1-t0) / CLOCKS_PER_SEC;
+}
+
+
+int main(int argc, char** argv) {
+    static const int widths[] = { 200, 600 };
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayTextMetrics metrics;
+    ParlayRGBARawImage image;
+    size_t n = 16000, l, w;
+    char* text;
+    int i, runs = 20, overfull, slack;
+    double raggedness;
+    clock_t t0, t1, t2;
+
+    if (argc < 2) {
+        fprintf(stderr,"usage: %s font-file [characters]\n",argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        n = (size_t)atol(argv[2]);
+    }
+    if (parlay_init() || parlay_register_font("bench",argv[1],NULL,NULL,NULL)) {
+        fprintf(stderr,"can't register %s\n",argv[1]);
+        return 1;
+    }
+    if ((text = make_paragraph(n)) == NULL) {
+        return 1;
+    }
+
+    parlay_style_defaults(&style);
+    style.font_name = "bench";
+    style.font_size = 16;
+    parlay_control_defaults(&ctl);
+    ctl.background_color[3] = 1.0f;
+    printf("%u characters, %d runs each\n",(unsigned)strlen(text),runs);
+
+    for (w = 0; w < sizeof(widths)/sizeof(widths[0]); w++) {
+        for (ctl.line_breaking = PARLAY_BREAK_GREEDY; ctl.line_breaking <= PARLAY_BREAK_OPTIMAL; ctl.line_breaking++) {
+            ctl.width = widths[w];
+            t0 = clock();
+            for (i = 0; i < runs; i++) {
+                if (i > 0) {
+                    parlay_free_text_metrics(&metrics);
+                }
+                if (parlay_measure_text(text,&style,&ctl,&metrics)) {
+                    fprintf(stderr,"measuring failed\n");
+                    return 1;
+                }
+            }
+            t1 = clock();
+            for (i = 0; i < runs; i++) {
+                if (parlay_plain_text(text,&style,&ctl,&image)) {
+                    fprintf(stderr,"rendering failed\n");
+                    return 1;
+                }
+                parlay_free_image_data(&image);
+            }
+            t2 = clock();
+
+            raggedness = 0;
+            overfull = 0;
+            for (l = 0; l + 1 < metrics.n_lines; l++) {
+                slack = ctl.width - metrics.lines[l].width;
+                if (slack < 0) {
+                    overfull++;
+                } else {
+                    raggedness += (double)slack * slack;
+                }
+            }
+            printf("%d px %-7s %5u lines  raggedness %10.0f  overfull %d  measure %7.2f ms  render %7.2f ms\n",
+                    ctl.width,ctl.line_breaking == PARLAY_BREAK_OPTIMAL ? "optimal" : "greedy",
+                    (unsigned)metrics.n_lines,raggedness,overfull,seconds(t0,t1)*1000.0/runs,
+                    seconds(t1,t2)*1000.0/runs);
+            parlay_free_text_metrics(&metrics);
+        }
+    }
+
+    free(text);
+    parlay_finalize();
+    return 0;
+}
@@ -0,0 +1,288 @@
+/* bench/thread-stress.c
+
+   Exercises the threading rules in the README under ThreadSanitizer.
+   The main thread registers a font twice in one context, once from the
+   file and once mapped, with the one file for all four styles, then
+   starts some workers and a churn thread.  Each worker clones that
+   context and renders labels in it, in every size, style, and border
+   method, through parlay_context_plain_text, layouts, measuring, and a
+   threaded batch; it also registers the same mapped file in a context
+   of its own and renders with that.  The churn thread meanwhile
+   creates, clones, and deletes contexts, and registers and unregisters
+   the mapped file, so the shared mapping's reference count moves while
+   the workers are using it.  It prints how many labels each worker
+   rendered and how long it all took, and exits with 1 if any call
+   failed.
+
+   It uses pthreads directly, so it only builds where they exist.  Build
+   and run it from the top of the tree with something like:
+
+     cc -g -O1 -fsanitize=thread -DPARLAY_USE_MINIXML=0 -I. \
+         $(pkg-config --cflags freetype2) parlay.c bench/thread-stress.c \
+         $(pkg-config --libs freetype2) -lm -lpthread -o thread-stress
+     ./thread-stress /path/to/font.ttf [threads] [rounds]
+
+   FreeType itself isn't instrumented, so races inside it won't show up,
+   but each context has its own FreeType library, so there shouldn't be
+   any.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "parlay.h"
+
+
+#define MAX_WORKERS 64
+
+typedef struct {
+    const ParlayContext* master;
+    const char* font_file;
+    int id;
+    int rounds;
+    int n_rendered;
+    int status;
+} Worker;
+
+
+static const char* labels[] = {
+    "Hello, world",
+    "Press START to continue",
+    "The quick brown fox jumps over the lazy dog, then naps in the sun for a while.",
+    "HP 120/120  MP 45/60",
+    "caf\xc3\xa9 na\xc3\xafve \xc3\xa9t\xc3\xa9",
+    "A longer line of dialog that wraps onto a few lines at the width the labels use.",
+};
+
+static pthread_mutex_t churn_lock = PTHREAD_MUTEX_INITIALIZER;
+static int churn_done = 0;
+
+
+static int is_churn_done(void) {
+    int done;
+    pthread_mutex_lock(&churn_lock);
+    done = churn_done;
+    pthread_mutex_unlock(&churn_lock);
+    return done;
+}
+
+
+static void set_up(ParlayStyle* style, ParlayControl* ctl, const char* font_name, int k) {
+    static const float sizes[] = { 9, 12, 16, 24, 40 };
+    parlay_style_defaults(style);
+    style->font_name = font_name;
+    style->font_size = sizes[k%5];
+    style->font_style = k%4;
+    style->text_color[0] = 0.9f;
+    style->text_color[3] = 1.0f;
+    style->border_thickness = k%3;
+    style->border_method = (k/3)%3;
+    style->border_color[3] = 0.8f;
+    style->highlight = (k%7) == 0;
+    style->highlight_color[2] = 1.0f;
+    style->highlight_color[3] = 0.5f;
+    style->underline = (k%5) == 0;
+    parlay_control_defaults(ctl);
+    ctl->width = (k%2) ? 200 : 0;
+    ctl->text_alignment = k%3;
+    ctl->kerning = (k%2) ? PARLAY_KERNING_ON : PARLAY_KERNING_OFF;
+    ctl->line_breaking = (k/2)%2;
+    ctl->background_color[3] = (k%4) ? 0.0f : 1.0f;
+}
+
+
+static int render_labels(ParlayContext* ctx, const char* font_name, Worker* w) {
+    ParlayStyle style;
+    ParlayControl ctl;
+    ParlayRGBARawImage image;
+    ParlayTextMetrics metrics;
+    ParlayLayout* layout;
+    size_t i, n_labels = sizeof(labels)/sizeof(labels[0]);
+    int k, status;
+
+    for (i = 0; i < n_labels; i++) {
+        k = (int)i + w->id * 7 + w->n_rendered;
+        set_up(&style,&ctl,font_name,k);
+        memset(&image,0,sizeof(image));
+        if ((status = parlay_context_plain_text(ctx,labels[i],&style,&ctl,&image)) != 0) {
+            return status;
+        }
+        parlay_free_image_data(&image);
+
+        if ((status = parlay_context_measure_text(ctx,labels[i],&style,&ctl,&metrics)) != 0) {
+            return status;
+        }
+        parlay_free_text_metrics(&metrics);
+
+        if ((status = parlay_context_layout_plain_text(ctx,labels[i],&style,&ctl,&layout)) != 0) {
+            return status;
+        }
+        if ((status = parlay_layout_render(layout,&ctl,&image)) == 0) {
+            parlay_free_image_data(&image);
+            parlay_layout_set_opacity(layout,0.5f);
+            if ((status = parlay_layout_render(layout,&ctl,&image)) == 0) {
+                parlay_free_image_data(&image);
+            }
+        }
+        parlay_layout_delete(layout);
+        if (status != 0) {
+            return status;
+        }
+        w->n_rendered++;
+    }
+    return 0;
+}
+
+
+static int render_batch(ParlayContext* ctx, const char* font_name) {
+    enum { N_ITEMS = 8 };
+    ParlayStyle styles[N_ITEMS];
+    ParlayControl ctls[N_ITEMS];
+    ParlayBatchItem items[N_ITEMS];
+    ParlayRGBARawImage images[N_ITEMS];
+    int statuses[N_ITEMS];
+    int i, status;
+
+    for (i = 0; i < N_ITEMS; i++) {
+        set_up(&styles[i],&ctls[i],font_name,i);
+        items[i].text = labels[i%(sizeof(labels)/sizeof(labels[0]))];
+        items[i].is_markup = 0;
+        items[i].style = &styles[i];
+        items[i].ctl = &ctls[i];
+    }
+    memset(images,0,sizeof(images));
+    status = parlay_context_render_batch(ctx,items,N_ITEMS,3,images,statuses);
+    for (i = 0; i < N_ITEMS; i++) {
+        parlay_free_image_data(&images[i]);
+    }
+    return status;
+}
+
+
+static void* worker_main(void* arg) {
+    Worker* w = (Worker*)arg;
+    ParlayContext* clone = NULL;
+    ParlayContext* own = NULL;
+    int r;
+
+    for (r = 0; r < w->rounds && w->status == 0; r++) {
+        if ((w->status = parlay_context_clone(w->master,&clone)) != 0) {
+            break;
+        }
+        if ((w->status = render_labels(clone,(r%2) ? "mapped" : "file",w)) == 0) {
+            w->status = render_batch(clone,"mapped");
+        }
+        parlay_context_delete(clone);
+        if (w->status != 0) {
+            break;
+        }
+
+        if ((w->status = parlay_context_new(0,0,0,&own)) != 0) {
+            break;
+        }
+        if ((w->status = parlay_context_register_mapped_font(own,"mapped",w->font_file,w->font_file,w->font_file,
+                w->font_file)) == 0) {
+            w->status = render_labels(own,"mapped",w);
+        }
+        parlay_context_delete(own);
+    }
+    return NULL;
+}
+
+
+// Keeps contexts coming and going, and the mapped file's reference count
+// moving, until the workers are done
+
+static void* churn_main(void* arg) {
+    Worker* w = (Worker*)arg;
+    ParlayContext* ctx = NULL;
+    ParlayContext* clone = NULL;
+
+    while (!is_churn_done() && w->status == 0) {
+        if ((w->status = parlay_context_new(0,0,0,&ctx)) != 0) {
+            break;
+        }
+        w->status = parlay_context_register_mapped_font(ctx,"mapped",w->font_file,NULL,NULL,NULL);
+        if (w->status == 0 && (w->status = parlay_context_clone(ctx,&clone)) == 0) {
+            w->status = parlay_context_unregister_font(ctx,"mapped");
+            parlay_context_delete(clone);
+        }
+        parlay_context_delete(ctx);
+        if (w->status == 0 && (w->status = parlay_context_clone(w->master,&clone)) == 0) {
+            parlay_context_delete(clone);
+        }
+        w->n_rendered++;
+    }
+    return NULL;
+}
+
+
+int main(int argc, char** argv) {
+    ParlayContext* master = NULL;
+    Worker workers[MAX_WORKERS+1];
+    pthread_t threads[MAX_WORKERS+1];
+    int i, n_workers = 4, rounds = 10, failed = 0;
+    clock_t t0;
+
+    if (argc < 2) {
+        fprintf(stderr,"usage: %s font-file [threads] [rounds]\n",argv[0]);
+        return 1;
+    }
+    if (argc > 2) {
+        n_workers = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        rounds = atoi(argv[3]);
+    }
+    if (n_workers < 1 || n_workers > MAX_WORKERS || rounds < 1) {
+        fprintf(stderr,"threads must be 1 to %d and rounds at least 1\n",MAX_WORKERS);
+        return 1;
+    }
+    if (parlay_context_new(0,0,0,&master)
+            || parlay_context_register_font(master,"file",argv[1],argv[1],argv[1],argv[1])
+            || parlay_context_register_mapped_font(master,"mapped",argv[1],argv[1],argv[1],argv[1])) {
+        fprintf(stderr,"can't set up a context with %s\n",argv[1]);
+        return 1;
+    }
+
+    // The master context is only read from here on, by the clones
+    t0 = clock();
+    for (i = 0; i <= n_workers; i++) {
+        workers[i].master = master;
+        workers[i].font_file = argv[1];
+        workers[i].id = i;
+        workers[i].rounds = rounds;
+        workers[i].n_rendered = 0;
+        workers[i].status = 0;
+        if (pthread_create(&threads[i],NULL,i < n_workers ? worker_main : churn_main,&workers[i])) {
+            fprintf(stderr,"can't start thread %d\n",i);
+            return 1;
+        }
+    }
+    for (i = 0; i < n_workers; i++) {
+        pthread_join(threads[i],NULL);
+    }
+    pthread_mutex_lock(&churn_lock);
+    churn_done = 1;
+    pthread_mutex_unlock(&churn_lock);
+    pthread_join(threads[n_workers],NULL);
+
+    for (i = 0; i <= n_workers; i++) {
+        if (i < n_workers) {
+            printf("worker %d: %d labels",i,workers[i].n_rendered);
+        } else {
+            printf("churn: %d rounds",workers[i].n_rendered);
+        }
+        if (workers[i].status != 0) {
+            printf(", failed with status %d",workers[i].status);
+            failed = 1;
+        }
+        printf("\n");
+    }
+    printf("%.2f s of CPU time\n",(double)(clock()-t0)/CLOCKS_PER_SEC);
+
+    parlay_context_delete(master);
+    return failed;
+}
@@ -6,9 +6,147 @@
 
 /* -------- Section one: Constants -------- */
 
-/* Invalid character constant */
+/* How many code points are decoded from UTF-8 at a time */
 
-#define INVALID_CHARACTER ((codepoint_t)-1)
+#define DECODE_BLOCK_SIZE 256
+
+
+/* Ways UTF-8 can be invalid */
+
+#define UTF8_BAD_BYTE 1
+#define UTF8_TRUNCATED 2
+#define UTF8_OVERLONG 3
+#define UTF8_SURROGATE 4
+#define UTF8_TOO_LARGE 5
+
+
+/* Bits for what a pair of bytes can't be, for the SIMD UTF-8 check */
+
+#define UTF8_ERR_TOO_SHORT 0x01
+#define UTF8_ERR_TOO_LONG 0x02
+#define UTF8_ERR_OVERLONG_3 0x04
+#define UTF8_ERR_TOO_LARGE 0x08
+#define UTF8_ERR_SURROGATE 0x10
+#define UTF8_ERR_OVERLONG_2 0x20
+#define UTF8_ERR_TOO_LARGE_1000 0x40
+#define UTF8_ERR_OVERLONG_4 0x40
+#define UTF8_ERR_TWO_CONTS 0x80
+#define UTF8_ERR_CARRY (UTF8_ERR_TOO_SHORT|UTF8_ERR_TOO_LONG|UTF8_ERR_TWO_CONTS)
+
+
+/* Outline cache sizing */
+
+#define OUTLINE_CACHE_BUCKETS 1024
+#define OUTLINE_CACHE_MAX_BYTES (4*1024*1024)
+
+
+/* Font registry sizing */
+
+#define FONT_REGISTRY_BUCKETS 256
+
+
+/* Glyph metrics cache sizing */
+
+#define METRICS_CACHE_BUCKETS 1024
+#define METRICS_CACHE_MAX_RECORDS 16384
+
+
+/* Kerning pair cache sizing */
+
+#define KERNING_CACHE_BUCKETS 1024
+#define KERNING_CACHE_MAX_RECORDS 16384
+
+
+/* Glyph file sizing.  Glyphs rendered after the file was read are only
+   added until there are this many bytes of them. */
+
+#define GLYPH_FILE_BUCKETS 4096
+#define GLYPH_FILE_MAX_NEW_BYTES (64*1024*1024)
+#define GLYPH_FILE_VERSION 1
+
+
+/* Glyph cache sizing.  The cache is open-addressed, so it's emptied when
+   it's three quarters full, or when the bitmaps copied into it reach the
+   byte limit.  The number of slots must be a power of two. */
+
+#define GLYPH_CACHE_SLOTS 8192
+#define GLYPH_CACHE_MAX_BYTES (8*1024*1024)
+#define GLYPH_CACHE_CHUNK_BYTES (64*1024)
+
+
+/* The cost of a line with a word too wide for it, for optimal line breaking */
+
+#define OVERFULL_LINE_COST 1e15
+
+
+/* Bidirectional character types */
+
+#define BIDI_L 0
+#define BIDI_R 1
+#define BIDI_AL 2
+#define BIDI_EN 3
+#define BIDI_ES 4
+#define BIDI_ET 5
+#define BIDI_AN 6
+#define BIDI_CS 7
+#define BIDI_NSM 8
+#define BIDI_BN 9
+#define BIDI_B 10
+#define BIDI_S 11
+#define BIDI_WS 12
+#define BIDI_ON 13
+
+
+/* Bracket types, and how deeply brackets can nest before the rest of a
+   paragraph's brackets are left unpaired (UAX #9 rule BD16) */
+
+#define BRACKET_OPEN 1
+#define BRACKET_CLOSE 2
+#define BRACKET_STACK_DEPTH 63
+
+
+/* Line breaking classes (UAX #14), and what the pair table says about
+   breaking between two of them */
+
+#define LB_OP 0
+#define LB_CL 1
+#define LB_CP 2
+#define LB_QU 3
+#define LB_GL 4
+#define LB_NS 5
+#define LB_EX 6
+#define LB_SY 7
+#define LB_IS 8
+#define LB_PR 9
+#define LB_PO 10
+#define LB_NU 11
+#define LB_AL 12
+#define LB_HL 13
+#define LB_ID 14
+#define LB_IN 15
+#define LB_HY 16
+#define LB_BA 17
+#define LB_BB 18
+#define LB_B2 19
+#define LB_ZW 20
+#define LB_CM 21
+#define LB_WJ 22
+#define LB_H2 23
+#define LB_H3 24
+#define LB_JL 25
+#define LB_JV 26
+#define LB_JT 27
+#define LB_RI 28
+#define LB_EB 29
+#define LB_EM 30
+#define LB_ZWJ 31
+#define LB_CB 32
+#define LB_SP 33
+#define LB_BK 34
+
+#define LB_DIRECT 0
+#define LB_INDIRECT 1
+#define LB_PROHIBITED 2
 
 
 /* -------- Section two: Types -------- */
@@ -18,24 +156,138 @@
 typedef unsigned codepoint_t;
 
 
-/* A record of face filenames for a particular font */
+/* A range of code points with the same bidirectional type */
+
+typedef struct {
+    codepoint_t first;
+    codepoint_t last;
+    unsigned char bidi_class;
+} BidiRange;
+
+
+/* A character and its mirror image */
+
+typedef struct {
+    codepoint_t c;
+    codepoint_t mirror;
+} MirrorPair;
+
+
+/* A bracket, the other bracket of its pair, and BRACKET_OPEN or
+   BRACKET_CLOSE */
+
+typedef struct {
+    codepoint_t c;
+    codepoint_t pair;
+    unsigned char type;
+} BracketPair;
+
+
+/* Which characters a face has glyphs for, as a bitmap split into pages of
+   256 characters.  Pages with none of them all share page 0, which is
+   empty. */
+
+#define COVERAGE_PAGE_SHIFT 8
+#define COVERAGE_PAGE_BYTES ((1 << COVERAGE_PAGE_SHIFT) / 8)
+
+typedef struct {
+    unsigned short page_index[0x110000 >> COVERAGE_PAGE_SHIFT];
+    size_t n_pages;
+    unsigned char* pages;
+} Coverage;
+
+
+/* A font file mapped into memory (or read into it, without mmap), shared by
+   every context that registers it */
+
+typedef struct _MappedFile {
+    const char* filename;
+    const unsigned char* data;
+    size_t size;
+    int n_refs;
+    struct _MappedFile* next;
+} MappedFile;
+
+
+/* Where a face's font data comes from: a file FreeType opens itself, or
+   bytes in memory, which are either the caller's or a mapped file.  A
+   pointer to one is the face ID that FreeType's caches know the face by. */
+
+typedef struct {
+    const char* filename;
+    const unsigned char* data;
+    size_t size;
+    MappedFile* mapped_file;
+    uint64_t glyph_file_key;
+    int glyph_file_key_state;
+} FaceSource;
+
+
+/* A record of the faces of a particular font, indexed by style, the fonts it
+   falls back on for characters it doesn't have, and its faces' coverage,
+   found as needed */
 
 typedef struct _FontRecord {
     const char* name;
-    const char* normal_filename;
-    const char* italic_filename;
-    const char* bold_filename;
-    const char* bold_italic_filename;
+    FaceSource faces[4];
+    ParlayFontHandle handle;
+    int registered;
+    ParlayFontHandle* fallbacks;
+    int n_fallbacks;
+    Coverage* coverage[4];
     struct _FontRecord* next;
 } FontRecord;
 
 
-/* Information about a layed-out glyph */
+/* A glyph as it's laid out and drawn: the glyph a character or glyph index
+   comes to in one face at one size, with its metrics and coverage bitmap.
+   The bitmap has a row every width bytes. */
 
 typedef struct {
     FTC_FaceID face_id;
+    int font_px;
+    uint32_t key;
+    int by_glyph_index;
+    FTC_FaceID glyph_face_id;
     FT_UInt glyph_index;
     int is_sbit;
+    int xadvance;
+    int left;
+    int top;
+    int width;
+    int height;
+    const unsigned char* bitmap;
+} GlyphCacheEntry;
+
+
+/* A block of memory that glyph bitmaps are copied into */
+
+typedef struct _GlyphCacheChunk {
+    size_t size;
+    size_t used;
+    struct _GlyphCacheChunk* next;
+} GlyphCacheChunk;
+
+
+/* The bitmaps a glyph cache copied in during one generation.  The cache
+   holds a reference to the current generation's, and each layout holds one
+   to every generation its glyphs' bitmaps are in, so emptying the cache
+   frees them only once no layout needs them. */
+
+typedef struct {
+    int n_refs;
+    GlyphCacheChunk* chunks;
+} GlyphBitmaps;
+
+
+/* Information about a layed-out glyph.  Its bitmap, if it was laid out to be
+   drawn, is one the layout holds a reference to. */
+
+typedef struct {
+    FTC_FaceID face_id;
+    FT_UInt glyph_index;
+    int is_sbit;
+    const unsigned char* bitmap;
     int font_px;
     int line_height;
     int x;
@@ -49,15 +301,26 @@ typedef struct {
     float text_color[4];
     int border_thickness;
     float border_color[4];
+    int border_method;
     int highlight;
     float highlight_color[4];
     int underline;
+    int hidden;
+    codepoint_t codepoint;
+    int mirrored;
+    int break_before;
+    int starts_paragraph;
+    int paragraph_level;
 } ParlayGlyphPlan;
 
 
-/* Information about a whole layout */
+/* Information about a whole layout.  Layouts handed out by the public API
+   remember the context they were made in, since their glyphs can only be
+   rendered from that context's caches, and a copy of their glyph plans as
+   they were last drawn, so the next render can redraw only what changed.
+   Every layout holds on to the glyph bitmaps its glyphs point at. */
 
-typedef struct {
+struct _ParlayLayout {
     ParlayGlyphPlan* glyph_plans;
     size_t n_glyphs_cap;
     size_t n_glyphs;
@@ -71,7 +334,340 @@ typedef struct {
     int y_image_offset;
     int any_borders;
     int any_highlights;
-} ParlayLayout;
+    int text_alignment;
+    int fixed_width;
+    float opacity;
+    int metrics_only;
+    int kerning;
+    int line_breaking;
+    int any_rtl;
+    size_t first_glyph_of_current_paragraph;
+    FTC_FaceID prev_face_id;
+    int prev_font_px;
+    FT_UInt prev_glyph_index;
+    int prev_line_break_class;
+    int line_break_after_spaces;
+    GlyphBitmaps** bitmaps;
+    size_t n_bitmaps_cap;
+    size_t n_bitmaps;
+    ParlayContext* ctx;
+    ParlayGlyphPlan* drawn_plans;
+    size_t n_drawn_cap;
+    size_t n_drawn;
+    int drawn;
+    float drawn_opacity;
+    float drawn_background_color[4];
+};
+
+
+/* The size, position, and advance a glyph would render with */
+
+typedef struct _MetricsRecord {
+    FTC_FaceID face_id;
+    FT_UInt glyph_index;
+    int font_px;
+    int is_sbit;
+    int xadvance;
+    int left;
+    int top;
+    int width;
+    int height;
+    struct _MetricsRecord* next;
+} MetricsRecord;
+
+
+/* A hash table of glyph metrics records */
+
+typedef struct {
+    MetricsRecord** buckets;
+    size_t n_records;
+} MetricsCache;
+
+
+/* The kerning between two glyphs at one size, in pixels */
+
+typedef struct _KerningRecord {
+    FTC_FaceID face_id;
+    int font_px;
+    FT_UInt left_glyph;
+    FT_UInt right_glyph;
+    int kerning;
+    struct _KerningRecord* next;
+} KerningRecord;
+
+
+/* A hash table of kerning records */
+
+typedef struct {
+    KerningRecord** buckets;
+    size_t n_records;
+} KerningCache;
+
+
+/* The header of a glyph file.  A file from another version of the format
+   or of FreeType, or from a machine with the other byte order, isn't read. */
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t freetype_version;
+    uint32_t byte_order;
+    uint32_t reserved;
+} GlyphFileHeader;
+
+
+/* A glyph in a glyph file.  Its coverage bitmap follows it, padded to a
+   multiple of 8 bytes.  Faces are known by a hash of what identifies the
+   font, since face IDs only last as long as a context. */
+
+typedef struct {
+    uint64_t face_key;
+    uint32_t glyph_index;
+    int32_t font_px;
+    int32_t is_sbit;
+    int32_t xadvance;
+    int32_t left;
+    int32_t top;
+    int32_t width;
+    int32_t height;
+} GlyphFileRecord;
+
+
+/* A glyph in a context's glyph file, either read from it or rendered since
+   and waiting to be saved */
+
+typedef struct _GlyphFileEntry {
+    GlyphFileRecord rec;
+    const unsigned char* bitmap;
+    int saved;
+    int allocated;
+    struct _GlyphFileEntry* next;
+} GlyphFileEntry;
+
+
+/* A persistent glyph cache: a file of rendered glyphs, mapped into memory,
+   with a hash table over its glyphs and the ones added since */
+
+typedef struct {
+    const char* filename;
+    const unsigned char* data;
+    size_t size;
+    GlyphFileEntry* file_entries;
+    GlyphFileEntry** buckets;
+    size_t n_new_bytes;
+    int rewrite;
+} GlyphFile;
+
+
+/* A context's glyph cache.  Entries stay where they are until the cache is
+   emptied, which starts a new generation of bitmaps. */
+
+typedef struct {
+    GlyphCacheEntry* slots;
+    size_t n_entries;
+    GlyphBitmaps* bitmaps;
+    size_t n_bytes;
+} GlyphCache;
+
+
+/* A span compositing kernel */
+
+typedef void (*BlendSpanFunction)(unsigned short* dst, const unsigned char* coverage, int n, const unsigned short rgb[3], unsigned alpha);
+
+
+/* A kernel that counts the ASCII bytes at the start of a string, copying them
+   out as code points if out isn't NULL */
+
+typedef size_t (*AsciiSpanFunction)(const unsigned char* s, size_t n, codepoint_t* out);
+
+
+/* A kernel that checks a string is valid UTF-8 (see check_utf8) */
+
+typedef int (*Utf8CheckFunction)(const unsigned char* s, size_t n, size_t* roffset);
+
+
+/* A window onto a layout, backed by a region of an RGBA8 buffer.  data points
+   at the pixel for layout position (x_origin, y_origin).  composite_layout
+   blends into work, four 16-bit channels per pixel and width*4 of them per
+   row, and converts the result to bytes in data at the end. */
+
+typedef struct {
+    unsigned char* data;
+    size_t pitch;
+    int width;
+    int height;
+    int x_origin;
+    int y_origin;
+    BlendSpanFunction blend_span;
+    unsigned short* work;
+} ParlayCanvas;
+
+
+/* Reusable scratch memory for building coverage masks and work canvases */
+
+typedef struct {
+    unsigned short* data;
+    size_t cap;
+} ParlayScratch;
+
+
+/* A cached border coverage mask for one glyph at one size, thickness, and
+   border method; the offsets place the mask relative to the glyph bitmap */
+
+typedef struct _OutlineRecord {
+    FTC_FaceID face_id;
+    FT_UInt glyph_index;
+    int font_px;
+    int border_thickness;
+    int border_method;
+    int x_offset;
+    int y_offset;
+    int width;
+    int height;
+    unsigned char* buffer;
+    struct _OutlineRecord* next;
+} OutlineRecord;
+
+
+/* A hash table of outline records */
+
+typedef struct {
+    OutlineRecord** buckets;
+    size_t n_bytes;
+} OutlineCache;
+
+
+/* The last face and size looked up by a context */
+
+typedef struct {
+    const FontRecord* font_rec;
+    int font_style;
+    int font_px;
+    FTC_FaceID face_id;
+    int line_height;
+    int ascender;
+    int has_kerning;
+} FaceMemo;
+
+
+/* Everything a context owns.  Nothing here is shared between contexts, so
+   different threads can use different contexts at the same time. */
+
+struct _ParlayContext {
+    unsigned max_faces;
+    unsigned max_sizes;
+    unsigned long max_bytes;
+    BlendSpanFunction blend_span;
+    AsciiSpanFunction ascii_span;
+    Utf8CheckFunction check_utf8;
+    FT_Library library;
+    FTC_Manager manager;
+    FTC_CMapCache cmap_cache;
+    FTC_SBitCache sbit_cache;
+    FTC_ImageCache image_cache;
+    FT_Stroker stroker;
+    FontRecord** fonts;
+    size_t n_fonts;
+    size_t fonts_cap;
+    FontRecord** font_buckets;
+    FontRecord* retired_fonts;
+    OutlineCache outline_cache;
+    MetricsCache metrics_cache;
+    KerningCache kerning_cache;
+    GlyphFile* glyph_file;
+    GlyphCache glyph_cache;
+    ParlayScratch scratch;
+    ParlayScratch work;
+    FaceMemo face_memo;
+    ParlayContext** batch_workers;
+    int n_batch_workers;
+    int utf8_error;
+    size_t utf8_error_offset;
+};
+
+
+/* One thread's share of a batch */
+
+typedef struct {
+    ParlayContext* ctx;
+    const ParlayBatchItem* items;
+    size_t n_items;
+    size_t first;
+    size_t stride;
+    ParlayRGBARawImage* images;
+    int* statuses;
+    size_t failed_item;
+    int status;
+    int thread_status;
+    int started;
+#if PARLAY_THREADS_WIN32
+    HANDLE thread;
+#elif PARLAY_THREADS_POSIX
+    pthread_t thread;
+#endif
+} BatchJob;
+
+
+/* One segment of an atlas page's skyline */
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+} SkylineSegment;
+
+
+/* A page of an atlas and the skyline of its used space */
+
+typedef struct {
+    unsigned char* data;
+    SkylineSegment* skyline;
+    size_t n_segments;
+    size_t segments_cap;
+} AtlasPage;
+
+
+/* A set of fixed-size pages that paragraphs are packed into */
+
+struct _ParlayAtlas {
+    int page_width;
+    int page_height;
+    int padding;
+    AtlasPage* pages;
+    size_t n_pages;
+    size_t pages_cap;
+};
+
+
+/* Where a glyph on a paragraph builder's open line was before the line was
+   laid out provisionally for rendering */
+
+typedef struct {
+    int x;
+    int line_height;
+    int ascender;
+} SavedGlyphPosition;
+
+
+/* A paragraph that text is appended to, and the image of it so far.  Glyphs
+   before first_dirty_glyph are on finished lines that are already drawn. */
+
+struct _ParlayParagraphBuilder {
+    ParlayLayout* layout;
+    int text_alignment;
+    float background_color[4];
+    int collapse_whitespace;
+    size_t n_aligned;
+    size_t n_rendered;
+    size_t first_dirty_glyph;
+    int stale_row;
+    int max_overhang;
+    unsigned char* data;
+    int height;
+    int rows_cap;
+    SavedGlyphPosition* saved;
+    size_t saved_cap;
+};
 
 
 /* -------- Section three: Inline functions -------- */
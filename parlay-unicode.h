@@ -0,0 +1,2009 @@
+/* parlay-unicode.h */
+
+#ifndef PARLAY_UNICODE_H
+#define PARLAY_UNICODE_H
+
+
+/* Section two, from its heading to the end of line_break_pairs, is the
+   output of tools/gen-line-break-tables.py; regenerate it rather than
+   editing it by hand. */
+
+
+/* -------- Section one: Bidirectional character types -------- */
+
+/* Ranges of code points whose bidirectional type isn't L, from the Unicode
+   Character Database, version 14.0.  Unassigned code points in right-to-left
+   blocks get the default type for their block.  The explicit embedding,
+   override, and isolate controls are listed as BN, since Parlay ignores them. */
+
+static const BidiRange bidi_ranges[] = {
+    {0x0000,0x0008,BIDI_BN},{0x0009,0x0009,BIDI_S},{0x000A,0x000A,BIDI_B},{0x000B,0x000B,BIDI_S},
+    {0x000C,0x000C,BIDI_WS},{0x000D,0x000D,BIDI_B},{0x000E,0x001B,BIDI_BN},{0x001C,0x001E,BIDI_B},
+    {0x001F,0x001F,BIDI_S},{0x0020,0x0020,BIDI_WS},{0x0021,0x0022,BIDI_ON},{0x0023,0x0025,BIDI_ET},
+    {0x0026,0x002A,BIDI_ON},{0x002B,0x002B,BIDI_ES},{0x002C,0x002C,BIDI_CS},{0x002D,0x002D,BIDI_ES},
+    {0x002E,0x002F,BIDI_CS},{0x0030,0x0039,BIDI_EN},{0x003A,0x003A,BIDI_CS},{0x003B,0x0040,BIDI_ON},
+    {0x005B,0x0060,BIDI_ON},{0x007B,0x007E,BIDI_ON},{0x007F,0x0084,BIDI_BN},{0x0085,0x0085,BIDI_B},
+    {0x0086,0x009F,BIDI_BN},{0x00A0,0x00A0,BIDI_CS},{0x00A1,0x00A1,BIDI_ON},{0x00A2,0x00A5,BIDI_ET},
+    {0x00A6,0x00A9,BIDI_ON},{0x00AB,0x00AC,BIDI_ON},{0x00AD,0x00AD,BIDI_BN},{0x00AE,0x00AF,BIDI_ON},
+    {0x00B0,0x00B1,BIDI_ET},{0x00B2,0x00B3,BIDI_EN},{0x00B4,0x00B4,BIDI_ON},{0x00B6,0x00B8,BIDI_ON},
+    {0x00B9,0x00B9,BIDI_EN},{0x00BB,0x00BF,BIDI_ON},{0x00D7,0x00D7,BIDI_ON},{0x00F7,0x00F7,BIDI_ON},
+    {0x02B9,0x02BA,BIDI_ON},{0x02C2,0x02CF,BIDI_ON},{0x02D2,0x02DF,BIDI_ON},{0x02E5,0x02ED,BIDI_ON},
+    {0x02EF,0x02FF,BIDI_ON},{0x0300,0x036F,BIDI_NSM},{0x0374,0x0375,BIDI_ON},{0x037E,0x037E,BIDI_ON},
+    {0x0384,0x0385,BIDI_ON},{0x0387,0x0387,BIDI_ON},{0x03F6,0x03F6,BIDI_ON},{0x0483,0x0489,BIDI_NSM},
+    {0x058A,0x058A,BIDI_ON},{0x058D,0x058E,BIDI_ON},{0x058F,0x058F,BIDI_ET},{0x0590,0x0590,BIDI_R},
+    {0x0591,0x05BD,BIDI_NSM},{0x05BE,0x05BE,BIDI_R},{0x05BF,0x05BF,BIDI_NSM},{0x05C0,0x05C0,BIDI_R},
+    {0x05C1,0x05C2,BIDI_NSM},{0x05C3,0x05C3,BIDI_R},{0x05C4,0x05C5,BIDI_NSM},{0x05C6,0x05C6,BIDI_R},
+    {0x05C7,0x05C7,BIDI_NSM},{0x05C8,0x05FF,BIDI_R},{0x0600,0x0605,BIDI_AN},{0x0606,0x0607,BIDI_ON},
+    {0x0608,0x0608,BIDI_AL},{0x0609,0x060A,BIDI_ET},{0x060B,0x060B,BIDI_AL},{0x060C,0x060C,BIDI_CS},
+    {0x060D,0x060D,BIDI_AL},{0x060E,0x060F,BIDI_ON},{0x0610,0x061A,BIDI_NSM},{0x061B,0x064A,BIDI_AL},
+    {0x064B,0x065F,BIDI_NSM},{0x0660,0x0669,BIDI_AN},{0x066A,0x066A,BIDI_ET},{0x066B,0x066C,BIDI_AN},
+    {0x066D,0x066F,BIDI_AL},{0x0670,0x0670,BIDI_NSM},{0x0671,0x06D5,BIDI_AL},{0x06D6,0x06DC,BIDI_NSM},
+    {0x06DD,0x06DD,BIDI_AN},{0x06DE,0x06DE,BIDI_ON},{0x06DF,0x06E4,BIDI_NSM},{0x06E5,0x06E6,BIDI_AL},
+    {0x06E7,0x06E8,BIDI_NSM},{0x06E9,0x06E9,BIDI_ON},{0x06EA,0x06ED,BIDI_NSM},{0x06EE,0x06EF,BIDI_AL},
+    {0x06F0,0x06F9,BIDI_EN},{0x06FA,0x0710,BIDI_AL},{0x0711,0x0711,BIDI_NSM},{0x0712,0x072F,BIDI_AL},
+    {0x0730,0x074A,BIDI_NSM},{0x074B,0x07A5,BIDI_AL},{0x07A6,0x07B0,BIDI_NSM},{0x07B1,0x07BF,BIDI_AL},
+    {0x07C0,0x07EA,BIDI_R},{0x07EB,0x07F3,BIDI_NSM},{0x07F4,0x07F5,BIDI_R},{0x07F6,0x07F9,BIDI_ON},
+    {0x07FA,0x07FC,BIDI_R},{0x07FD,0x07FD,BIDI_NSM},{0x07FE,0x0815,BIDI_R},{0x0816,0x0819,BIDI_NSM},
+    {0x081A,0x081A,BIDI_R},{0x081B,0x0823,BIDI_NSM},{0x0824,0x0824,BIDI_R},{0x0825,0x0827,BIDI_NSM},
+    {0x0828,0x0828,BIDI_R},{0x0829,0x082D,BIDI_NSM},{0x082E,0x0858,BIDI_R},{0x0859,0x085B,BIDI_NSM},
+    {0x085C,0x085F,BIDI_R},{0x0860,0x088F,BIDI_AL},{0x0890,0x0891,BIDI_AN},{0x0892,0x0897,BIDI_AL},
+    {0x0898,0x089F,BIDI_NSM},{0x08A0,0x08C9,BIDI_AL},{0x08CA,0x08E1,BIDI_NSM},{0x08E2,0x08E2,BIDI_AN},
+    {0x08E3,0x0902,BIDI_NSM},{0x093A,0x093A,BIDI_NSM},{0x093C,0x093C,BIDI_NSM},{0x0941,0x0948,BIDI_NSM},
+    {0x094D,0x094D,BIDI_NSM},{0x0951,0x0957,BIDI_NSM},{0x0962,0x0963,BIDI_NSM},{0x0981,0x0981,BIDI_NSM},
+    {0x09BC,0x09BC,BIDI_NSM},{0x09C1,0x09C4,BIDI_NSM},{0x09CD,0x09CD,BIDI_NSM},{0x09E2,0x09E3,BIDI_NSM},
+    {0x09F2,0x09F3,BIDI_ET},{0x09FB,0x09FB,BIDI_ET},{0x09FE,0x09FE,BIDI_NSM},{0x0A01,0x0A02,BIDI_NSM},
+    {0x0A3C,0x0A3C,BIDI_NSM},{0x0A41,0x0A42,BIDI_NSM},{0x0A47,0x0A48,BIDI_NSM},{0x0A4B,0x0A4D,BIDI_NSM},
+    {0x0A51,0x0A51,BIDI_NSM},{0x0A70,0x0A71,BIDI_NSM},{0x0A75,0x0A75,BIDI_NSM},{0x0A81,0x0A82,BIDI_NSM},
+    {0x0ABC,0x0ABC,BIDI_NSM},{0x0AC1,0x0AC5,BIDI_NSM},{0x0AC7,0x0AC8,BIDI_NSM},{0x0ACD,0x0ACD,BIDI_NSM},
+    {0x0AE2,0x0AE3,BIDI_NSM},{0x0AF1,0x0AF1,BIDI_ET},{0x0AFA,0x0AFF,BIDI_NSM},{0x0B01,0x0B01,BIDI_NSM},
+    {0x0B3C,0x0B3C,BIDI_NSM},{0x0B3F,0x0B3F,BIDI_NSM},{0x0B41,0x0B44,BIDI_NSM},{0x0B4D,0x0B4D,BIDI_NSM},
+    {0x0B55,0x0B56,BIDI_NSM},{0x0B62,0x0B63,BIDI_NSM},{0x0B82,0x0B82,BIDI_NSM},{0x0BC0,0x0BC0,BIDI_NSM},
+    {0x0BCD,0x0BCD,BIDI_NSM},{0x0BF3,0x0BF8,BIDI_ON},{0x0BF9,0x0BF9,BIDI_ET},{0x0BFA,0x0BFA,BIDI_ON},
+    {0x0C00,0x0C00,BIDI_NSM},{0x0C04,0x0C04,BIDI_NSM},{0x0C3C,0x0C3C,BIDI_NSM},{0x0C3E,0x0C40,BIDI_NSM},
+    {0x0C46,0x0C48,BIDI_NSM},{0x0C4A,0x0C4D,BIDI_NSM},{0x0C55,0x0C56,BIDI_NSM},{0x0C62,0x0C63,BIDI_NSM},
+    {0x0C78,0x0C7E,BIDI_ON},{0x0C81,0x0C81,BIDI_NSM},{0x0CBC,0x0CBC,BIDI_NSM},{0x0CCC,0x0CCD,BIDI_NSM},
+    {0x0CE2,0x0CE3,BIDI_NSM},{0x0D00,0x0D01,BIDI_NSM},{0x0D3B,0x0D3C,BIDI_NSM},{0x0D41,0x0D44,BIDI_NSM},
+    {0x0D4D,0x0D4D,BIDI_NSM},{0x0D62,0x0D63,BIDI_NSM},{0x0D81,0x0D81,BIDI_NSM},{0x0DCA,0x0DCA,BIDI_NSM},
+    {0x0DD2,0x0DD4,BIDI_NSM},{0x0DD6,0x0DD6,BIDI_NSM},{0x0E31,0x0E31,BIDI_NSM},{0x0E34,0x0E3A,BIDI_NSM},
+    {0x0E3F,0x0E3F,BIDI_ET},{0x0E47,0x0E4E,BIDI_NSM},{0x0EB1,0x0EB1,BIDI_NSM},{0x0EB4,0x0EBC,BIDI_NSM},
+    {0x0EC8,0x0ECD,BIDI_NSM},{0x0F18,0x0F19,BIDI_NSM},{0x0F35,0x0F35,BIDI_NSM},{0x0F37,0x0F37,BIDI_NSM},
+    {0x0F39,0x0F39,BIDI_NSM},{0x0F3A,0x0F3D,BIDI_ON},{0x0F71,0x0F7E,BIDI_NSM},{0x0F80,0x0F84,BIDI_NSM},
+    {0x0F86,0x0F87,BIDI_NSM},{0x0F8D,0x0F97,BIDI_NSM},{0x0F99,0x0FBC,BIDI_NSM},{0x0FC6,0x0FC6,BIDI_NSM},
+    {0x102D,0x1030,BIDI_NSM},{0x1032,0x1037,BIDI_NSM},{0x1039,0x103A,BIDI_NSM},{0x103D,0x103E,BIDI_NSM},
+    {0x1058,0x1059,BIDI_NSM},{0x105E,0x1060,BIDI_NSM},{0x1071,0x1074,BIDI_NSM},{0x1082,0x1082,BIDI_NSM},
+    {0x1085,0x1086,BIDI_NSM},{0x108D,0x108D,BIDI_NSM},{0x109D,0x109D,BIDI_NSM},{0x135D,0x135F,BIDI_NSM},
+    {0x1390,0x1399,BIDI_ON},{0x1400,0x1400,BIDI_ON},{0x1680,0x1680,BIDI_WS},{0x169B,0x169C,BIDI_ON},
+    {0x1712,0x1714,BIDI_NSM},{0x1732,0x1733,BIDI_NSM},{0x1752,0x1753,BIDI_NSM},{0x1772,0x1773,BIDI_NSM},
+    {0x17B4,0x17B5,BIDI_NSM},{0x17B7,0x17BD,BIDI_NSM},{0x17C6,0x17C6,BIDI_NSM},{0x17C9,0x17D3,BIDI_NSM},
+    {0x17DB,0x17DB,BIDI_ET},{0x17DD,0x17DD,BIDI_NSM},{0x17F0,0x17F9,BIDI_ON},{0x1800,0x180A,BIDI_ON},
+    {0x180B,0x180D,BIDI_NSM},{0x180E,0x180E,BIDI_BN},{0x180F,0x180F,BIDI_NSM},{0x1885,0x1886,BIDI_NSM},
+    {0x18A9,0x18A9,BIDI_NSM},{0x1920,0x1922,BIDI_NSM},{0x1927,0x1928,BIDI_NSM},{0x1932,0x1932,BIDI_NSM},
+    {0x1939,0x193B,BIDI_NSM},{0x1940,0x1940,BIDI_ON},{0x1944,0x1945,BIDI_ON},{0x19DE,0x19FF,BIDI_ON},
+    {0x1A17,0x1A18,BIDI_NSM},{0x1A1B,0x1A1B,BIDI_NSM},{0x1A56,0x1A56,BIDI_NSM},{0x1A58,0x1A5E,BIDI_NSM},
+    {0x1A60,0x1A60,BIDI_NSM},{0x1A62,0x1A62,BIDI_NSM},{0x1A65,0x1A6C,BIDI_NSM},{0x1A73,0x1A7C,BIDI_NSM},
+    {0x1A7F,0x1A7F,BIDI_NSM},{0x1AB0,0x1ACE,BIDI_NSM},{0x1B00,0x1B03,BIDI_NSM},{0x1B34,0x1B34,BIDI_NSM},
+    {0x1B36,0x1B3A,BIDI_NSM},{0x1B3C,0x1B3C,BIDI_NSM},{0x1B42,0x1B42,BIDI_NSM},{0x1B6B,0x1B73,BIDI_NSM},
+    {0x1B80,0x1B81,BIDI_NSM},{0x1BA2,0x1BA5,BIDI_NSM},{0x1BA8,0x1BA9,BIDI_NSM},{0x1BAB,0x1BAD,BIDI_NSM},
+    {0x1BE6,0x1BE6,BIDI_NSM},{0x1BE8,0x1BE9,BIDI_NSM},{0x1BED,0x1BED,BIDI_NSM},{0x1BEF,0x1BF1,BIDI_NSM},
+    {0x1C2C,0x1C33,BIDI_NSM},{0x1C36,0x1C37,BIDI_NSM},{0x1CD0,0x1CD2,BIDI_NSM},{0x1CD4,0x1CE0,BIDI_NSM},
+    {0x1CE2,0x1CE8,BIDI_NSM},{0x1CED,0x1CED,BIDI_NSM},{0x1CF4,0x1CF4,BIDI_NSM},{0x1CF8,0x1CF9,BIDI_NSM},
+    {0x1DC0,0x1DFF,BIDI_NSM},{0x1FBD,0x1FBD,BIDI_ON},{0x1FBF,0x1FC1,BIDI_ON},{0x1FCD,0x1FCF,BIDI_ON},
+    {0x1FDD,0x1FDF,BIDI_ON},{0x1FED,0x1FEF,BIDI_ON},{0x1FFD,0x1FFE,BIDI_ON},{0x2000,0x200A,BIDI_WS},
+    {0x200B,0x200D,BIDI_BN},{0x200F,0x200F,BIDI_R},{0x2010,0x2027,BIDI_ON},{0x2028,0x2028,BIDI_WS},
+    {0x2029,0x2029,BIDI_B},{0x202A,0x202E,BIDI_BN},{0x202F,0x202F,BIDI_CS},{0x2030,0x2034,BIDI_ET},
+    {0x2035,0x2043,BIDI_ON},{0x2044,0x2044,BIDI_CS},{0x2045,0x205E,BIDI_ON},{0x205F,0x205F,BIDI_WS},
+    {0x2060,0x2064,BIDI_BN},{0x2066,0x206F,BIDI_BN},{0x2070,0x2070,BIDI_EN},{0x2074,0x2079,BIDI_EN},
+    {0x207A,0x207B,BIDI_ES},{0x207C,0x207E,BIDI_ON},{0x2080,0x2089,BIDI_EN},{0x208A,0x208B,BIDI_ES},
+    {0x208C,0x208E,BIDI_ON},{0x20A0,0x20CF,BIDI_ET},{0x20D0,0x20F0,BIDI_NSM},{0x2100,0x2101,BIDI_ON},
+    {0x2103,0x2106,BIDI_ON},{0x2108,0x2109,BIDI_ON},{0x2114,0x2114,BIDI_ON},{0x2116,0x2118,BIDI_ON},
+    {0x211E,0x2123,BIDI_ON},{0x2125,0x2125,BIDI_ON},{0x2127,0x2127,BIDI_ON},{0x2129,0x2129,BIDI_ON},
+    {0x212E,0x212E,BIDI_ET},{0x213A,0x213B,BIDI_ON},{0x2140,0x2144,BIDI_ON},{0x214A,0x214D,BIDI_ON},
+    {0x2150,0x215F,BIDI_ON},{0x2189,0x218B,BIDI_ON},{0x2190,0x2211,BIDI_ON},{0x2212,0x2212,BIDI_ES},
+    {0x2213,0x2213,BIDI_ET},{0x2214,0x2335,BIDI_ON},{0x237B,0x2394,BIDI_ON},{0x2396,0x2426,BIDI_ON},
+    {0x2440,0x244A,BIDI_ON},{0x2460,0x2487,BIDI_ON},{0x2488,0x249B,BIDI_EN},{0x24EA,0x26AB,BIDI_ON},
+    {0x26AD,0x27FF,BIDI_ON},{0x2900,0x2B73,BIDI_ON},{0x2B76,0x2B95,BIDI_ON},{0x2B97,0x2BFF,BIDI_ON},
+    {0x2CE5,0x2CEA,BIDI_ON},{0x2CEF,0x2CF1,BIDI_NSM},{0x2CF9,0x2CFF,BIDI_ON},{0x2D7F,0x2D7F,BIDI_NSM},
+    {0x2DE0,0x2DFF,BIDI_NSM},{0x2E00,0x2E5D,BIDI_ON},{0x2E80,0x2E99,BIDI_ON},{0x2E9B,0x2EF3,BIDI_ON},
+    {0x2F00,0x2FD5,BIDI_ON},{0x2FF0,0x2FFB,BIDI_ON},{0x3000,0x3000,BIDI_WS},{0x3001,0x3004,BIDI_ON},
+    {0x3008,0x3020,BIDI_ON},{0x302A,0x302D,BIDI_NSM},{0x3030,0x3030,BIDI_ON},{0x3036,0x3037,BIDI_ON},
+    {0x303D,0x303F,BIDI_ON},{0x3099,0x309A,BIDI_NSM},{0x309B,0x309C,BIDI_ON},{0x30A0,0x30A0,BIDI_ON},
+    {0x30FB,0x30FB,BIDI_ON},{0x31C0,0x31E3,BIDI_ON},{0x321D,0x321E,BIDI_ON},{0x3250,0x325F,BIDI_ON},
+    {0x327C,0x327E,BIDI_ON},{0x32B1,0x32BF,BIDI_ON},{0x32CC,0x32CF,BIDI_ON},{0x3377,0x337A,BIDI_ON},
+    {0x33DE,0x33DF,BIDI_ON},{0x33FF,0x33FF,BIDI_ON},{0x4DC0,0x4DFF,BIDI_ON},{0xA490,0xA4C6,BIDI_ON},
+    {0xA60D,0xA60F,BIDI_ON},{0xA66F,0xA672,BIDI_NSM},{0xA673,0xA673,BIDI_ON},{0xA674,0xA67D,BIDI_NSM},
+    {0xA67E,0xA67F,BIDI_ON},{0xA69E,0xA69F,BIDI_NSM},{0xA6F0,0xA6F1,BIDI_NSM},{0xA700,0xA721,BIDI_ON},
+    {0xA788,0xA788,BIDI_ON},{0xA802,0xA802,BIDI_NSM},{0xA806,0xA806,BIDI_NSM},{0xA80B,0xA80B,BIDI_NSM},
+    {0xA825,0xA826,BIDI_NSM},{0xA828,0xA82B,BIDI_ON},{0xA82C,0xA82C,BIDI_NSM},{0xA838,0xA839,BIDI_ET},
+    {0xA874,0xA877,BIDI_ON},{0xA8C4,0xA8C5,BIDI_NSM},{0xA8E0,0xA8F1,BIDI_NSM},{0xA8FF,0xA8FF,BIDI_NSM},
+    {0xA926,0xA92D,BIDI_NSM},{0xA947,0xA951,BIDI_NSM},{0xA980,0xA982,BIDI_NSM},{0xA9B3,0xA9B3,BIDI_NSM},
+    {0xA9B6,0xA9B9,BIDI_NSM},{0xA9BC,0xA9BD,BIDI_NSM},{0xA9E5,0xA9E5,BIDI_NSM},{0xAA29,0xAA2E,BIDI_NSM},
+    {0xAA31,0xAA32,BIDI_NSM},{0xAA35,0xAA36,BIDI_NSM},{0xAA43,0xAA43,BIDI_NSM},{0xAA4C,0xAA4C,BIDI_NSM},
+    {0xAA7C,0xAA7C,BIDI_NSM},{0xAAB0,0xAAB0,BIDI_NSM},{0xAAB2,0xAAB4,BIDI_NSM},{0xAAB7,0xAAB8,BIDI_NSM},
+    {0xAABE,0xAABF,BIDI_NSM},{0xAAC1,0xAAC1,BIDI_NSM},{0xAAEC,0xAAED,BIDI_NSM},{0xAAF6,0xAAF6,BIDI_NSM},
+    {0xAB6A,0xAB6B,BIDI_ON},{0xABE5,0xABE5,BIDI_NSM},{0xABE8,0xABE8,BIDI_NSM},{0xABED,0xABED,BIDI_NSM},
+    {0xFB1D,0xFB1D,BIDI_R},{0xFB1E,0xFB1E,BIDI_NSM},{0xFB1F,0xFB28,BIDI_R},{0xFB29,0xFB29,BIDI_ES},
+    {0xFB2A,0xFB4F,BIDI_R},{0xFB50,0xFD3D,BIDI_AL},{0xFD3E,0xFD4F,BIDI_ON},{0xFD50,0xFDCE,BIDI_AL},
+    {0xFDCF,0xFDCF,BIDI_ON},{0xFDF0,0xFDFC,BIDI_AL},{0xFDFD,0xFDFF,BIDI_ON},{0xFE00,0xFE0F,BIDI_NSM},
+    {0xFE10,0xFE19,BIDI_ON},{0xFE20,0xFE2F,BIDI_NSM},{0xFE30,0xFE4F,BIDI_ON},{0xFE50,0xFE50,BIDI_CS},
+    {0xFE51,0xFE51,BIDI_ON},{0xFE52,0xFE52,BIDI_CS},{0xFE54,0xFE54,BIDI_ON},{0xFE55,0xFE55,BIDI_CS},
+    {0xFE56,0xFE5E,BIDI_ON},{0xFE5F,0xFE5F,BIDI_ET},{0xFE60,0xFE61,BIDI_ON},{0xFE62,0xFE63,BIDI_ES},
+    {0xFE64,0xFE66,BIDI_ON},{0xFE68,0xFE68,BIDI_ON},{0xFE69,0xFE6A,BIDI_ET},{0xFE6B,0xFE6B,BIDI_ON},
+    {0xFE70,0xFEFE,BIDI_AL},{0xFEFF,0xFEFF,BIDI_BN},{0xFF01,0xFF02,BIDI_ON},{0xFF03,0xFF05,BIDI_ET},
+    {0xFF06,0xFF0A,BIDI_ON},{0xFF0B,0xFF0B,BIDI_ES},{0xFF0C,0xFF0C,BIDI_CS},{0xFF0D,0xFF0D,BIDI_ES},
+    {0xFF0E,0xFF0F,BIDI_CS},{0xFF10,0xFF19,BIDI_EN},{0xFF1A,0xFF1A,BIDI_CS},{0xFF1B,0xFF20,BIDI_ON},
+    {0xFF3B,0xFF40,BIDI_ON},{0xFF5B,0xFF65,BIDI_ON},{0xFFE0,0xFFE1,BIDI_ET},{0xFFE2,0xFFE4,BIDI_ON},
+    {0xFFE5,0xFFE6,BIDI_ET},{0xFFE8,0xFFEE,BIDI_ON},{0xFFF9,0xFFFD,BIDI_ON},{0x10101,0x10101,BIDI_ON},
+    {0x10140,0x1018C,BIDI_ON},{0x10190,0x1019C,BIDI_ON},{0x101A0,0x101A0,BIDI_ON},{0x101FD,0x101FD,BIDI_NSM},
+    {0x102E0,0x102E0,BIDI_NSM},{0x102E1,0x102FB,BIDI_EN},{0x10376,0x1037A,BIDI_NSM},{0x10800,0x1091E,BIDI_R},
+    {0x1091F,0x1091F,BIDI_ON},{0x10920,0x10A00,BIDI_R},{0x10A01,0x10A03,BIDI_NSM},{0x10A04,0x10A04,BIDI_R},
+    {0x10A05,0x10A06,BIDI_NSM},{0x10A07,0x10A0B,BIDI_R},{0x10A0C,0x10A0F,BIDI_NSM},{0x10A10,0x10A37,BIDI_R},
+    {0x10A38,0x10A3A,BIDI_NSM},{0x10A3B,0x10A3E,BIDI_R},{0x10A3F,0x10A3F,BIDI_NSM},{0x10A40,0x10AE4,BIDI_R},
+    {0x10AE5,0x10AE6,BIDI_NSM},{0x10AE7,0x10B38,BIDI_R},{0x10B39,0x10B3F,BIDI_ON},{0x10B40,0x10CFF,BIDI_R},
+    {0x10D00,0x10D23,BIDI_AL},{0x10D24,0x10D27,BIDI_NSM},{0x10D28,0x10D2F,BIDI_AL},{0x10D30,0x10D39,BIDI_AN},
+    {0x10D3A,0x10D3F,BIDI_AL},{0x10D40,0x10E5F,BIDI_R},{0x10E60,0x10E7E,BIDI_AN},{0x10E7F,0x10EAA,BIDI_R},
+    {0x10EAB,0x10EAC,BIDI_NSM},{0x10EAD,0x10EBF,BIDI_R},{0x10EC0,0x10EFF,BIDI_AL},{0x10F00,0x10F2F,BIDI_R},
+    {0x10F30,0x10F45,BIDI_AL},{0x10F46,0x10F50,BIDI_NSM},{0x10F51,0x10F6F,BIDI_AL},{0x10F70,0x10F81,BIDI_R},
+    {0x10F82,0x10F85,BIDI_NSM},{0x10F86,0x10FFF,BIDI_R},{0x11001,0x11001,BIDI_NSM},{0x11038,0x11046,BIDI_NSM},
+    {0x11052,0x11065,BIDI_ON},{0x11070,0x11070,BIDI_NSM},{0x11073,0x11074,BIDI_NSM},{0x1107F,0x11081,BIDI_NSM},
+    {0x110B3,0x110B6,BIDI_NSM},{0x110B9,0x110BA,BIDI_NSM},{0x110C2,0x110C2,BIDI_NSM},{0x11100,0x11102,BIDI_NSM},
+    {0x11127,0x1112B,BIDI_NSM},{0x1112D,0x11134,BIDI_NSM},{0x11173,0x11173,BIDI_NSM},{0x11180,0x11181,BIDI_NSM},
+    {0x111B6,0x111BE,BIDI_NSM},{0x111C9,0x111CC,BIDI_NSM},{0x111CF,0x111CF,BIDI_NSM},{0x1122F,0x11231,BIDI_NSM},
+    {0x11234,0x11234,BIDI_NSM},{0x11236,0x11237,BIDI_NSM},{0x1123E,0x1123E,BIDI_NSM},{0x112DF,0x112DF,BIDI_NSM},
+    {0x112E3,0x112EA,BIDI_NSM},{0x11300,0x11301,BIDI_NSM},{0x1133B,0x1133C,BIDI_NSM},{0x11340,0x11340,BIDI_NSM},
+    {0x11366,0x1136C,BIDI_NSM},{0x11370,0x11374,BIDI_NSM},{0x11438,0x1143F,BIDI_NSM},{0x11442,0x11444,BIDI_NSM},
+    {0x11446,0x11446,BIDI_NSM},{0x1145E,0x1145E,BIDI_NSM},{0x114B3,0x114B8,BIDI_NSM},{0x114BA,0x114BA,BIDI_NSM},
+    {0x114BF,0x114C0,BIDI_NSM},{0x114C2,0x114C3,BIDI_NSM},{0x115B2,0x115B5,BIDI_NSM},{0x115BC,0x115BD,BIDI_NSM},
+    {0x115BF,0x115C0,BIDI_NSM},{0x115DC,0x115DD,BIDI_NSM},{0x11633,0x1163A,BIDI_NSM},{0x1163D,0x1163D,BIDI_NSM},
+    {0x1163F,0x11640,BIDI_NSM},{0x11660,0x1166C,BIDI_ON},{0x116AB,0x116AB,BIDI_NSM},{0x116AD,0x116AD,BIDI_NSM},
+    {0x116B0,0x116B5,BIDI_NSM},{0x116B7,0x116B7,BIDI_NSM},{0x1171D,0x1171F,BIDI_NSM},{0x11722,0x11725,BIDI_NSM},
+    {0x11727,0x1172B,BIDI_NSM},{0x1182F,0x11837,BIDI_NSM},{0x11839,0x1183A,BIDI_NSM},{0x1193B,0x1193C,BIDI_NSM},
+    {0x1193E,0x1193E,BIDI_NSM},{0x11943,0x11943,BIDI_NSM},{0x119D4,0x119D7,BIDI_NSM},{0x119DA,0x119DB,BIDI_NSM},
+    {0x119E0,0x119E0,BIDI_NSM},{0x11A01,0x11A06,BIDI_NSM},{0x11A09,0x11A0A,BIDI_NSM},{0x11A33,0x11A38,BIDI_NSM},
+    {0x11A3B,0x11A3E,BIDI_NSM},{0x11A47,0x11A47,BIDI_NSM},{0x11A51,0x11A56,BIDI_NSM},{0x11A59,0x11A5B,BIDI_NSM},
+    {0x11A8A,0x11A96,BIDI_NSM},{0x11A98,0x11A99,BIDI_NSM},{0x11C30,0x11C36,BIDI_NSM},{0x11C38,0x11C3D,BIDI_NSM},
+    {0x11C92,0x11CA7,BIDI_NSM},{0x11CAA,0x11CB0,BIDI_NSM},{0x11CB2,0x11CB3,BIDI_NSM},{0x11CB5,0x11CB6,BIDI_NSM},
+    {0x11D31,0x11D36,BIDI_NSM},{0x11D3A,0x11D3A,BIDI_NSM},{0x11D3C,0x11D3D,BIDI_NSM},{0x11D3F,0x11D45,BIDI_NSM},
+    {0x11D47,0x11D47,BIDI_NSM},{0x11D90,0x11D91,BIDI_NSM},{0x11D95,0x11D95,BIDI_NSM},{0x11D97,0x11D97,BIDI_NSM},
+    {0x11EF3,0x11EF4,BIDI_NSM},{0x11FD5,0x11FDC,BIDI_ON},{0x11FDD,0x11FE0,BIDI_ET},{0x11FE1,0x11FF1,BIDI_ON},
+    {0x16AF0,0x16AF4,BIDI_NSM},{0x16B30,0x16B36,BIDI_NSM},{0x16F4F,0x16F4F,BIDI_NSM},{0x16F8F,0x16F92,BIDI_NSM},
+    {0x16FE2,0x16FE2,BIDI_ON},{0x16FE4,0x16FE4,BIDI_NSM},{0x1BC9D,0x1BC9E,BIDI_NSM},{0x1BCA0,0x1BCA3,BIDI_BN},
+    {0x1CF00,0x1CF2D,BIDI_NSM},{0x1CF30,0x1CF46,BIDI_NSM},{0x1D167,0x1D169,BIDI_NSM},{0x1D173,0x1D17A,BIDI_BN},
+    {0x1D17B,0x1D182,BIDI_NSM},{0x1D185,0x1D18B,BIDI_NSM},{0x1D1AA,0x1D1AD,BIDI_NSM},{0x1D1E9,0x1D1EA,BIDI_ON},
+    {0x1D200,0x1D241,BIDI_ON},{0x1D242,0x1D244,BIDI_NSM},{0x1D245,0x1D245,BIDI_ON},{0x1D300,0x1D356,BIDI_ON},
+    {0x1D6DB,0x1D6DB,BIDI_ON},{0x1D715,0x1D715,BIDI_ON},{0x1D74F,0x1D74F,BIDI_ON},{0x1D789,0x1D789,BIDI_ON},
+    {0x1D7C3,0x1D7C3,BIDI_ON},{0x1D7CE,0x1D7FF,BIDI_EN},{0x1DA00,0x1DA36,BIDI_NSM},{0x1DA3B,0x1DA6C,BIDI_NSM},
+    {0x1DA75,0x1DA75,BIDI_NSM},{0x1DA84,0x1DA84,BIDI_NSM},{0x1DA9B,0x1DA9F,BIDI_NSM},{0x1DAA1,0x1DAAF,BIDI_NSM},
+    {0x1E000,0x1E006,BIDI_NSM},{0x1E008,0x1E018,BIDI_NSM},{0x1E01B,0x1E021,BIDI_NSM},{0x1E023,0x1E024,BIDI_NSM},
+    {0x1E026,0x1E02A,BIDI_NSM},{0x1E130,0x1E136,BIDI_NSM},{0x1E2AE,0x1E2AE,BIDI_NSM},{0x1E2EC,0x1E2EF,BIDI_NSM},
+    {0x1E2FF,0x1E2FF,BIDI_ET},{0x1E800,0x1E8CF,BIDI_R},{0x1E8D0,0x1E8D6,BIDI_NSM},{0x1E8D7,0x1E943,BIDI_R},
+    {0x1E944,0x1E94A,BIDI_NSM},{0x1E94B,0x1EC6F,BIDI_R},{0x1EC70,0x1ECBF,BIDI_AL},{0x1ECC0,0x1ECFF,BIDI_R},
+    {0x1ED00,0x1ED4F,BIDI_AL},{0x1ED50,0x1EDFF,BIDI_R},{0x1EE00,0x1EEEF,BIDI_AL},{0x1EEF0,0x1EEF1,BIDI_ON},
+    {0x1EEF2,0x1EEFF,BIDI_AL},{0x1EF00,0x1EFFF,BIDI_R},{0x1F000,0x1F02B,BIDI_ON},{0x1F030,0x1F093,BIDI_ON},
+    {0x1F0A0,0x1F0AE,BIDI_ON},{0x1F0B1,0x1F0BF,BIDI_ON},{0x1F0C1,0x1F0CF,BIDI_ON},{0x1F0D1,0x1F0F5,BIDI_ON},
+    {0x1F100,0x1F10A,BIDI_EN},{0x1F10B,0x1F10F,BIDI_ON},{0x1F12F,0x1F12F,BIDI_ON},{0x1F16A,0x1F16F,BIDI_ON},
+    {0x1F1AD,0x1F1AD,BIDI_ON},{0x1F260,0x1F265,BIDI_ON},{0x1F300,0x1F6D7,BIDI_ON},{0x1F6DD,0x1F6EC,BIDI_ON},
+    {0x1F6F0,0x1F6FC,BIDI_ON},{0x1F700,0x1F773,BIDI_ON},{0x1F780,0x1F7D8,BIDI_ON},{0x1F7E0,0x1F7EB,BIDI_ON},
+    {0x1F7F0,0x1F7F0,BIDI_ON},{0x1F800,0x1F80B,BIDI_ON},{0x1F810,0x1F847,BIDI_ON},{0x1F850,0x1F859,BIDI_ON},
+    {0x1F860,0x1F887,BIDI_ON},{0x1F890,0x1F8AD,BIDI_ON},{0x1F8B0,0x1F8B1,BIDI_ON},{0x1F900,0x1FA53,BIDI_ON},
+    {0x1FA60,0x1FA6D,BIDI_ON},{0x1FA70,0x1FA74,BIDI_ON},{0x1FA78,0x1FA7C,BIDI_ON},{0x1FA80,0x1FA86,BIDI_ON},
+    {0x1FA90,0x1FAAC,BIDI_ON},{0x1FAB0,0x1FABA,BIDI_ON},{0x1FAC0,0x1FAC5,BIDI_ON},{0x1FAD0,0x1FAD9,BIDI_ON},
+    {0x1FAE0,0x1FAE7,BIDI_ON},{0x1FAF0,0x1FAF6,BIDI_ON},{0x1FB00,0x1FB92,BIDI_ON},{0x1FB94,0x1FBCA,BIDI_ON},
+    {0x1FBF0,0x1FBF9,BIDI_EN},{0xE0001,0xE0001,BIDI_BN},{0xE0020,0xE007F,BIDI_BN},{0xE0100,0xE01EF,BIDI_NSM}
+};
+
+
+/* Pairs of characters that are each other's mirror image, such as brackets,
+   sorted by the first of the pair.  This is the commonly used part of
+   BidiMirroring.txt, not all of it. */
+
+static const MirrorPair mirror_pairs[] = {
+    {0x0028,0x0029},{0x0029,0x0028},{0x003C,0x003E},{0x003E,0x003C},
+    {0x005B,0x005D},{0x005D,0x005B},{0x007B,0x007D},{0x007D,0x007B},
+    {0x00AB,0x00BB},{0x00BB,0x00AB},{0x2039,0x203A},{0x203A,0x2039},
+    {0x2045,0x2046},{0x2046,0x2045},{0x207D,0x207E},{0x207E,0x207D},
+    {0x208D,0x208E},{0x208E,0x208D},{0x2208,0x220B},{0x2209,0x220C},
+    {0x220B,0x2208},{0x220C,0x2209},{0x2264,0x2265},{0x2265,0x2264},
+    {0x226A,0x226B},{0x226B,0x226A},{0x2329,0x232A},{0x232A,0x2329},
+    {0x27E8,0x27E9},{0x27E9,0x27E8},{0x3008,0x3009},{0x3009,0x3008},
+    {0x300A,0x300B},{0x300B,0x300A},{0x300C,0x300D},{0x300D,0x300C},
+    {0x300E,0x300F},{0x300F,0x300E},{0x3010,0x3011},{0x3011,0x3010},
+    {0x3014,0x3015},{0x3015,0x3014},{0x3016,0x3017},{0x3017,0x3016},
+    {0x3018,0x3019},{0x3019,0x3018},{0x301A,0x301B},{0x301B,0x301A},
+    {0xFF08,0xFF09},{0xFF09,0xFF08},{0xFF1C,0xFF1E},{0xFF1E,0xFF1C},
+    {0xFF3B,0xFF3D},{0xFF3D,0xFF3B},{0xFF5B,0xFF5D},{0xFF5D,0xFF5B},
+    {0xFF5F,0xFF60},{0xFF60,0xFF5F},{0xFF62,0xFF63},{0xFF63,0xFF62}
+};
+
+
+/* Bracket pairs, from BidiBrackets.txt in the Unicode Character Database,
+   version 14.0, sorted by the bracket.  Each gives the other bracket of its
+   pair and whether it opens or closes. */
+
+static const BracketPair bidi_brackets[] = {
+    {0x0028,0x0029,BRACKET_OPEN},{0x0029,0x0028,BRACKET_CLOSE},{0x005B,0x005D,BRACKET_OPEN},{0x005D,0x005B,BRACKET_CLOSE},
+    {0x007B,0x007D,BRACKET_OPEN},{0x007D,0x007B,BRACKET_CLOSE},{0x0F3A,0x0F3B,BRACKET_OPEN},{0x0F3B,0x0F3A,BRACKET_CLOSE},
+    {0x0F3C,0x0F3D,BRACKET_OPEN},{0x0F3D,0x0F3C,BRACKET_CLOSE},{0x169B,0x169C,BRACKET_OPEN},{0x169C,0x169B,BRACKET_CLOSE},
+    {0x2045,0x2046,BRACKET_OPEN},{0x2046,0x2045,BRACKET_CLOSE},{0x207D,0x207E,BRACKET_OPEN},{0x207E,0x207D,BRACKET_CLOSE},
+    {0x208D,0x208E,BRACKET_OPEN},{0x208E,0x208D,BRACKET_CLOSE},{0x2308,0x2309,BRACKET_OPEN},{0x2309,0x2308,BRACKET_CLOSE},
+    {0x230A,0x230B,BRACKET_OPEN},{0x230B,0x230A,BRACKET_CLOSE},{0x2329,0x232A,BRACKET_OPEN},{0x232A,0x2329,BRACKET_CLOSE},
+    {0x2768,0x2769,BRACKET_OPEN},{0x2769,0x2768,BRACKET_CLOSE},{0x276A,0x276B,BRACKET_OPEN},{0x276B,0x276A,BRACKET_CLOSE},
+    {0x276C,0x276D,BRACKET_OPEN},{0x276D,0x276C,BRACKET_CLOSE},{0x276E,0x276F,BRACKET_OPEN},{0x276F,0x276E,BRACKET_CLOSE},
+    {0x2770,0x2771,BRACKET_OPEN},{0x2771,0x2770,BRACKET_CLOSE},{0x2772,0x2773,BRACKET_OPEN},{0x2773,0x2772,BRACKET_CLOSE},
+    {0x2774,0x2775,BRACKET_OPEN},{0x2775,0x2774,BRACKET_CLOSE},{0x27C5,0x27C6,BRACKET_OPEN},{0x27C6,0x27C5,BRACKET_CLOSE},
+    {0x27E6,0x27E7,BRACKET_OPEN},{0x27E7,0x27E6,BRACKET_CLOSE},{0x27E8,0x27E9,BRACKET_OPEN},{0x27E9,0x27E8,BRACKET_CLOSE},
+    {0x27EA,0x27EB,BRACKET_OPEN},{0x27EB,0x27EA,BRACKET_CLOSE},{0x27EC,0x27ED,BRACKET_OPEN},{0x27ED,0x27EC,BRACKET_CLOSE},
+    {0x27EE,0x27EF,BRACKET_OPEN},{0x27EF,0x27EE,BRACKET_CLOSE},{0x2983,0x2984,BRACKET_OPEN},{0x2984,0x2983,BRACKET_CLOSE},
+    {0x2985,0x2986,BRACKET_OPEN},{0x2986,0x2985,BRACKET_CLOSE},{0x2987,0x2988,BRACKET_OPEN},{0x2988,0x2987,BRACKET_CLOSE},
+    {0x2989,0x298A,BRACKET_OPEN},{0x298A,0x2989,BRACKET_CLOSE},{0x298B,0x298C,BRACKET_OPEN},{0x298C,0x298B,BRACKET_CLOSE},
+    {0x298D,0x2990,BRACKET_OPEN},{0x298E,0x298F,BRACKET_CLOSE},{0x298F,0x298E,BRACKET_OPEN},{0x2990,0x298D,BRACKET_CLOSE},
+    {0x2991,0x2992,BRACKET_OPEN},{0x2992,0x2991,BRACKET_CLOSE},{0x2993,0x2994,BRACKET_OPEN},{0x2994,0x2993,BRACKET_CLOSE},
+    {0x2995,0x2996,BRACKET_OPEN},{0x2996,0x2995,BRACKET_CLOSE},{0x2997,0x2998,BRACKET_OPEN},{0x2998,0x2997,BRACKET_CLOSE},
+    {0x29D8,0x29D9,BRACKET_OPEN},{0x29D9,0x29D8,BRACKET_CLOSE},{0x29DA,0x29DB,BRACKET_OPEN},{0x29DB,0x29DA,BRACKET_CLOSE},
+    {0x29FC,0x29FD,BRACKET_OPEN},{0x29FD,0x29FC,BRACKET_CLOSE},{0x2E22,0x2E23,BRACKET_OPEN},{0x2E23,0x2E22,BRACKET_CLOSE},
+    {0x2E24,0x2E25,BRACKET_OPEN},{0x2E25,0x2E24,BRACKET_CLOSE},{0x2E26,0x2E27,BRACKET_OPEN},{0x2E27,0x2E26,BRACKET_CLOSE},
+    {0x2E28,0x2E29,BRACKET_OPEN},{0x2E29,0x2E28,BRACKET_CLOSE},{0x2E55,0x2E56,BRACKET_OPEN},{0x2E56,0x2E55,BRACKET_CLOSE},
+    {0x2E57,0x2E58,BRACKET_OPEN},{0x2E58,0x2E57,BRACKET_CLOSE},{0x2E59,0x2E5A,BRACKET_OPEN},{0x2E5A,0x2E59,BRACKET_CLOSE},
+    {0x2E5B,0x2E5C,BRACKET_OPEN},{0x2E5C,0x2E5B,BRACKET_CLOSE},{0x3008,0x3009,BRACKET_OPEN},{0x3009,0x3008,BRACKET_CLOSE},
+    {0x300A,0x300B,BRACKET_OPEN},{0x300B,0x300A,BRACKET_CLOSE},{0x300C,0x300D,BRACKET_OPEN},{0x300D,0x300C,BRACKET_CLOSE},
+    {0x300E,0x300F,BRACKET_OPEN},{0x300F,0x300E,BRACKET_CLOSE},{0x3010,0x3011,BRACKET_OPEN},{0x3011,0x3010,BRACKET_CLOSE},
+    {0x3014,0x3015,BRACKET_OPEN},{0x3015,0x3014,BRACKET_CLOSE},{0x3016,0x3017,BRACKET_OPEN},{0x3017,0x3016,BRACKET_CLOSE},
+    {0x3018,0x3019,BRACKET_OPEN},{0x3019,0x3018,BRACKET_CLOSE},{0x301A,0x301B,BRACKET_OPEN},{0x301B,0x301A,BRACKET_CLOSE},
+    {0xFE59,0xFE5A,BRACKET_OPEN},{0xFE5A,0xFE59,BRACKET_CLOSE},{0xFE5B,0xFE5C,BRACKET_OPEN},{0xFE5C,0xFE5B,BRACKET_CLOSE},
+    {0xFE5D,0xFE5E,BRACKET_OPEN},{0xFE5E,0xFE5D,BRACKET_CLOSE},{0xFF08,0xFF09,BRACKET_OPEN},{0xFF09,0xFF08,BRACKET_CLOSE},
+    {0xFF3B,0xFF3D,BRACKET_OPEN},{0xFF3D,0xFF3B,BRACKET_CLOSE},{0xFF5B,0xFF5D,BRACKET_OPEN},{0xFF5D,0xFF5B,BRACKET_CLOSE},
+    {0xFF5F,0xFF60,BRACKET_OPEN},{0xFF60,0xFF5F,BRACKET_CLOSE},{0xFF62,0xFF63,BRACKET_OPEN},{0xFF63,0xFF62,BRACKET_CLOSE}
+};
+
+
+/* -------- Section two: Line breaking classes -------- */
+
+/* The line breaking class of every code point, from LineBreak.txt in the
+   Unicode Character Database, version 14.0, split into blocks of 128 code
+   points.  line_break_index gives the block for each run of 128 code points,
+   and line_break_blocks holds the blocks, each stored once, so a lookup is
+   two loads.  The classes have already been resolved as UAX #14 rule LB1
+   says: AI, SG, and XX are AL, CJ is NS, and SA is CM for marks and AL for
+   everything else.  CR, LF, and NL are listed as BK, and the white space
+   characters in BA (tab, the fixed width spaces, and so on) as SP. */
+
+static const unsigned char line_break_index[0x110000 >> 7] = {
+      0,  1,  2,  2,  2,  3,  4,  2,  2,  5,  2,  6,  7,  8,  9, 10,
+     11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+     27, 28, 29, 30,  2,  2, 31,  2, 32,  2,  2,  2,  2, 33, 34, 35,
+     36, 37, 38, 39, 40, 41, 42, 43, 44, 45,  2, 46,  2,  2,  2, 47,
+     48, 49, 50,  2, 51, 52, 53, 54,  2,  2,  2,  2, 55, 56, 57, 58,
+      2,  2,  2, 59,  2,  2,  2,  2,  2, 60, 61, 62, 63, 64, 65, 66,
+     67, 68, 69, 70, 71, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 72, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     73, 65, 65, 65, 65, 65, 65, 65, 65, 74,  2,  2, 75, 76,  2,  2,
+     77, 78, 79, 80, 81, 82,  2, 83, 84, 85, 86, 87, 88, 89, 90, 84,
+     85, 86, 87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90, 84, 85, 86,
+     87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90, 84, 85, 86, 87, 88,
+     89, 90, 84, 85, 86, 87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90,
+     84, 85, 86, 87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90, 84, 85,
+     86, 87, 88, 89, 90, 84, 85, 86, 87, 88, 89, 90, 84, 85, 86, 91,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2, 65, 65, 65, 65, 92,  2,  2,  2, 93, 94, 95, 96, 97, 98,
+      2,  2, 99,100,  2,101,102,103,  2,104,  2,  2,  2,  2,  2,  2,
+    105,  2,106,  2,107,108,109,  2,  2,  2,110,  2,  2,111,112,113,
+    114,115,116,117,118,119,120,  2,121,122,  2,123,124,125,126,  2,
+    127,128,129,130,131,132,  2,  2,133,134,135,136,  2,137,  2,138,
+      2,  2,  2,  2,  2,  2,  2,  2,139,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,140,141,142,  2,143,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,144,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,145,146,147,  2,  2,  2,  2,  2,  2,148,149,150,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,151,
+     65, 65, 65, 65, 65, 65,  2,  2,  2,  2,152,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+     65, 65,153, 65, 65,154,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,155,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,156,  2,
+      2,  2,157,158,159,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,160,
+      2,  2,  2,  2,161,162,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    163,  2,164,  2,  2,165,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,166,167,  2,  2,  2,  2,  2,  2,168,  2,  2,  2,  2,  2,  2,
+     65, 65,169,170, 65, 65, 65,171,172,173,174,175,176,177,178,179,
+    180,181,182,183,184,185,  2,186, 65, 65, 65, 65, 65, 65, 65,187,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,187,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+     65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,187,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+    188,  2,189,190,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+      2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2
+};
+
+static const unsigned char line_break_blocks[191][128] = {
+  {
+    21,21,21,21,21,21,21,21,21,33,34,34,34,34,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    33,6,3,12,9,10,12,3,0,2,12,9,8,16,8,7,11,11,11,11,11,11,11,11,11,11,8,8,12,12,12,6,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,9,2,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,17,1,12,21
+  },
+  {
+    21,21,21,21,21,34,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    4,0,10,9,9,9,12,12,12,12,12,3,12,17,12,12,10,9,12,12,18,12,12,12,12,12,12,3,12,12,12,0,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,18,12,12,12,18,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,18,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,4,21,21,21,21,21,21,21,21,21,21,21,21,4,4,4,4,
+    4,4,4,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,8,12
+  },
+  {
+    12,12,12,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,8,17,12,12,12,12,9,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,17,21,
+    12,21,21,12,21,21,6,21,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+    13,13,13,13,13,13,13,13,13,13,13,12,12,12,12,13,13,13,13,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,10,10,10,8,8,12,12,21,21,21,21,21,21,21,21,21,21,21,6,21,6,6,6,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    11,11,11,11,11,11,11,11,11,11,10,11,11,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,6,12,21,21,21,21,21,21,21,12,12,21,
+    21,21,21,21,21,12,12,21,21,12,21,21,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,12,12,12,12,8,6,12,12,12,21,9,9
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,21,21,21,21,21,
+    21,21,21,21,12,21,21,21,12,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,
+    12,12,21,21,17,17,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,21,21,12,12,21,21,12,12,21,21,21,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,10,10,12,12,12,12,12,10,12,9,12,12,21,12
+  },
+  {
+    12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,12,12,12,12,21,21,12,12,21,21,21,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,21,21,12,12,12,21,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,21,21,21,12,21,21,21,12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,9,12,12,12,12,12,12,12,12,21,21,21,21,21,21
+  },
+  {
+    12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,21,21,12,12,21,21,12,12,21,21,21,12,12,12,12,12,12,12,21,21,21,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,
+    21,21,21,12,12,12,21,21,21,12,21,21,21,21,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,9,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,21,21,12,21,21,21,12,21,21,21,21,12,12,12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,18,12,12,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,18,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,
+    21,21,21,21,21,12,21,21,21,12,21,21,21,21,12,12,12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,12,21,21,
+    21,21,21,21,21,12,21,21,21,12,21,21,21,21,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,10,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,21,12,12,12,12,21,21,21,21,21,21,12,21,12,21,21,21,21,21,21,21,21,
+    12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,12,21,21,21,21,21,21,21,12,12,12,12,9,
+    12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,12,11,11,11,11,11,11,11,11,11,11,17,17,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,12,21,21,21,21,21,21,21,21,21,12,12,12,
+    12,12,12,12,12,12,12,12,21,21,21,21,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,18,18,18,18,12,18,18,4,18,18,17,4,6,6,6,6,6,4,12,6,12,12,12,21,21,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,17,21,12,21,12,21,0,1,0,1,21,21,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,17
+  },
+  {
+    21,21,21,21,21,17,21,21,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,12,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,17,17,
+    12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,18,18,17,18,12,12,12,12,12,4,4,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,
+    11,11,11,11,11,11,11,11,11,11,17,17,12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,12,12,12,21,21,
+    21,12,21,21,21,12,12,21,21,21,21,21,21,21,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,21,21,21,21,21,21,21,21,21,21,21,21,12,21,11,11,11,11,11,11,11,11,11,11,21,21,21,21,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26
+  },
+  {
+    26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+    27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+    27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,
+    12,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    33,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,17,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,17,17,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,17,17,5,12,17,12,17,9,12,21,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,6,6,17,17,18,12,6,6,12,21,21,21,4,21,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,
+    12,12,12,12,6,6,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,21
+  },
+  {
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,17,17,12,17,17,17,
+    17,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,17,17,12
+  },
+  {
+    21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,17,17,17,17,17,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,12,12,12,12,21,12,12,12,12,12,12,21,12,12,21,21,21,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,18,12,12
+  },
+  {
+    33,33,33,33,33,33,33,4,33,33,33,20,21,31,21,21,17,4,17,17,19,12,12,12,3,3,0,3,3,3,0,3,
+    12,12,12,12,15,15,15,17,34,34,21,21,21,21,21,4,10,10,10,10,10,10,10,10,12,3,3,12,5,5,12,12,
+    12,12,12,12,8,0,1,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,17,12,17,17,17,17,12,17,17,33,
+    22,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    9,9,9,9,9,9,9,10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,10,9,9,9,9,10,9,9,10,9,
+    10,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,10,12,12,12,12,12,10,12,12,12,12,12,12,12,12,12,12,12,12,9,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,9,9,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,15,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,0,1,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,12,12,14,12,14,14,14,29,14,14,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,
+    14,14,14,14,14,14,14,14,14,12,12,12,12,14,12,14,14,14,12,14,14,12,12,12,14,14,12,12,14,12,12,14,
+    14,14,12,12,12,12,12,12,12,12,14,12,12,12,12,12,12,14,14,14,14,14,12,14,14,29,14,12,12,14,14,14
+  },
+  {
+    14,14,14,14,14,12,12,12,14,14,29,29,29,29,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,3,3,3,3,3,
+    3,12,6,6,14,12,12,12,0,1,0,1,0,1,0,1,0,1,0,1,0,1,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,0,1,0,1,0,1,0,1,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,0,1,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,12,12,12,12,12,12,6,17,17,17,12,6,17
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    3,3,3,3,3,3,3,3,3,3,3,3,3,3,17,17,17,17,17,17,17,17,12,17,0,17,12,12,3,3,12,12,
+    3,3,0,1,0,1,0,1,0,1,17,17,17,17,6,12,17,17,12,17,17,12,12,12,12,12,19,19,17,17,17,12,
+    17,17,0,17,17,17,17,17,17,17,17,12,17,12,17,17,12,12,12,6,6,0,1,0,1,0,1,0,1,17,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12
+  },
+  {
+    33,1,1,14,14,5,14,14,0,1,0,1,0,1,0,1,0,1,14,14,0,1,0,1,0,1,0,1,5,0,1,1,
+    14,14,14,14,14,14,14,14,14,14,21,21,21,21,21,21,14,14,14,14,14,21,14,14,14,14,14,5,5,14,14,14,
+    12,5,14,5,14,5,14,5,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,5,14,5,14,5,14,14,14,14,14,14,5,14,14,14,14,14,14,5,5,12,12,21,21,5,5,5,5,14,
+    5,5,14,5,14,5,14,5,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,5,14,5,14,5,14,14,14,14,14,14,5,14,14,14,14,14,14,5,5,14,14,14,14,5,5,5,5,14
+  },
+  {
+    12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,17,6,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,21,21,21,21,21,21,21,21,21,21,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,12,17,17,17,17,17,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,21,12,12,12,21,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,21,21,21,21,21,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,10,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,18,18,6,6,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,12,12,12,12,12,12,12,12,17,17,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,18,12,12,21
+  },
+  {
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,21,21,21,21,21,21,21,21,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,
+    25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,12,12,12
+  },
+  {
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,12,12,12,12,12,12,17,17,17,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,
+    12,12,12,21,12,12,12,12,12,12,12,12,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,17,17,17,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,21,12,12,21,21,12,12,12,12,12,21,21,
+    12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,17,17,12,12,12,21,21,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,21,21,21,21,21,21,21,21,17,21,21,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24
+  },
+  {
+    24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+    24,24,24,24,12,12,12,12,12,12,12,12,12,12,12,12,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+    26,26,26,26,26,26,26,12,12,12,12,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+    27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,13,21,13,
+    13,13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,13,13,12,13,12,
+    13,13,12,13,13,12,13,13,13,13,13,13,13,13,13,13,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,1,0,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,10,12,12,12
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,1,1,8,8,6,6,0,1,15,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,14,14,14,14,14,0,1,0,1,0,1,0,1,0,1,0,
+    1,0,1,0,1,14,14,0,1,14,14,14,14,14,14,14,1,14,1,12,5,5,6,6,14,0,1,0,1,0,1,14,
+    14,14,14,14,14,14,14,12,14,9,10,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,22
+  },
+  {
+    12,6,14,14,9,10,14,14,0,1,14,14,1,14,1,14,14,14,14,14,14,14,14,14,14,14,5,5,14,14,14,6,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,14,1,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,0,14,1,14,0,
+    1,1,0,1,1,5,14,5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,
+    12,12,14,14,14,14,14,14,12,12,14,14,14,14,14,14,12,12,14,14,14,14,14,14,12,12,14,14,14,12,12,12,
+    10,9,14,14,14,9,9,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,32,12,12,12
+  },
+  {
+    17,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,12,21,21,12,12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,12,12,12,12,21,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17,17,17,17,17,17,17,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,17,17,17,17,17,17,15,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17,17,17,17,17,17,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,21,12,12,21,21,12,12,12,12,12,12,12,12,12,12,21
+  },
+  {
+    21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,12,12,12,17,17,
+    17,17,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,11,11,11,11,11,11,11,11,11,11,
+    17,17,17,17,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,18,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,12,12,12,12,17,17,12,17,21,21,21,21,12,21,21,11,11,11,11,11,11,11,11,11,11,12,18,12,17,17,17,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,17,17,12,17,17,12,21,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,
+    21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,12,21,21,
+    21,21,21,21,21,12,12,21,21,12,12,21,21,21,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,
+    12,12,21,21,12,12,21,21,21,21,21,21,21,12,12,12,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,12,12,12,12,17,17,17,17,12,11,11,11,11,11,11,11,11,11,11,17,17,12,12,21,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,12,12,21,21,21,21,21,21,21,21,
+    21,18,17,17,6,6,12,12,12,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,12,12,12,12,21,21,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    18,18,18,18,18,18,18,18,18,18,18,18,18,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,17,17,17,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,12,21,21,12,12,21,21,21,21,12,
+    21,12,21,21,17,17,17,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,12,12,21,21,21,21,21,21,
+    21,12,18,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,12,21,21,21,21,18,
+    12,17,17,17,17,18,12,21,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,17,17,17,12,18,18,
+    18,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,12,21,21,21,21,21,21,21,21,
+    12,17,17,17,17,17,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,18,6,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,12,12,12,21,12,21,21,12,21,
+    21,21,21,21,21,21,12,21,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,12,21,21,12,21,21,21,21,21,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,10,10,10,
+    10,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17,17,17,17,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,0,0,1,1,1,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,1,12,12,12,0,1,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,1,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,4,4,4,4,4,4,4,0,1,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,0,1,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,17,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,17,17,17,12,12,12,12,12,12,
+    12,12,12,12,17,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,17,17,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    5,5,5,5,4,12,12,12,12,12,12,12,12,12,12,12,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,5,5,5,5,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,17,
+    21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,21,21,21,21,21,12,12,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    21,21,21,12,12,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+    11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,21,12,12,17,17,17,17,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,
+    12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    21,21,21,21,21,21,21,12,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,21,21,21,21,21,
+    21,21,12,21,21,12,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,
+    11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,9
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,21,21,21,21,21,21,21,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,0,0,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,10,12,12,12,10,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28
+  },
+  {
+    14,14,14,14,14,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,14,14,14,14,14,12,14,14,14,
+    14,14,29,29,29,14,14,29,14,14,29,29,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,30,30,30,30,30
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,29,29,14,14,29,29,29,29,29,29,29,29,29,29,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,14,14,14,29,14,14,14
+  },
+  {
+    14,29,29,29,14,29,29,29,14,14,14,14,14,14,14,29,14,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    12,14,12,14,12,14,14,14,14,14,29,14,14,14,14,12,14,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,29,14,14,14,14,29,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,14,14,14,14,29,29,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12,12,12,12,12,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,29,29,29,14,14,14,29,29,29,29,29,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,3,3,3,5,5,5,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,29,29,14,14,14,14,14,14,14,14,14,
+    29,14,14,14,14,14,14,14,14,14,14,14,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  },
+  {
+    12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,29,14,14,29,14,14,14,14,14,14,14,14,29,29,29,29,29,29,29,29,
+    14,14,14,14,14,14,29,14,14,14,14,14,14,14,14,14,29,29,29,29,29,29,29,29,29,29,14,14,29,29,29,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,29,14,29,29,14,29,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,29,29,29,14,29,29,29,29,29,29,29,29,29,29,29,29,29,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,29,29,29,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,29,29,29,29,29,29,29,14,14,14,14,14,14,14,14,14
+  },
+  {
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,11,11,11,11,12,12,12,12,12,12
+  },
+  {
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+    14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,12,12
+  },
+  {
+    12,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21
+  },
+  {
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+    21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  }
+};
+
+/* Whether a line can break between two characters, by their line breaking
+   classes (rules LB7 through LB31 of UAX #14), indexed by the class before
+   and the class after.  LB_DIRECT means it can; LB_INDIRECT means only if
+   spaces come between them; LB_PROHIBITED means it can't, even with spaces
+   between.  The columns are in the same order as the rows.  Rule LB21a and
+   the East Asian width condition of LB30 are ignored, and regional
+   indicators are never split. */
+
+static const unsigned char line_break_pairs[LB_CB+1][LB_CB+1] = {
+    /* OP  */ {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    /* CL  */ {0,2,2,1,1,2,2,2,2,1,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* CP  */ {0,2,2,1,1,2,2,2,2,1,1,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* QU  */ {2,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,1},
+    /* GL  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,1},
+    /* NS  */ {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* EX  */ {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* SY  */ {0,2,2,1,1,1,2,2,2,0,0,1,0,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* IS  */ {0,2,2,1,1,1,2,2,2,0,0,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* PR  */ {1,2,2,1,1,1,2,2,2,0,0,1,1,1,1,1,1,1,0,0,2,2,2,1,1,1,1,1,0,1,1,2,0},
+    /* PO  */ {1,2,2,1,1,1,2,2,2,0,0,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* NU  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* AL  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* HL  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* ID  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* IN  */ {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* HY  */ {0,2,2,1,0,1,2,2,2,0,0,1,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* BA  */ {0,2,2,1,0,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* BB  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,0},
+    /* B2  */ {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,2,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* ZW  */ {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0},
+    /* CM  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* WJ  */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,1},
+    /* H2  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,1,1,0,0,0,2,0},
+    /* H3  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,1,0,0,0,2,0},
+    /* JL  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,1,1,1,1,0,0,0,0,2,0},
+    /* JV  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,1,1,0,0,0,2,0},
+    /* JT  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,1,0,0,0,2,0},
+    /* RI  */ {0,2,2,1,1,1,2,2,2,0,0,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,1,0,0,2,0},
+    /* EB  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,1,2,0},
+    /* EM  */ {0,2,2,1,1,1,2,2,2,0,1,0,0,0,0,1,1,1,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0},
+    /* ZWJ */ {1,2,2,1,1,1,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,1,1,1,1,1,1,1,1,2,1},
+    /* CB  */ {0,2,2,1,1,0,2,2,2,0,0,0,0,0,0,0,0,0,0,0,2,2,2,0,0,0,0,0,0,0,0,2,0}
+};
+
+#endif
@@ -2,6 +2,7 @@
 
 #define _CRT_SECURE_NO_WARNINGS
 
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -11,92 +12,201 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_CACHE_H
+#include FT_GLYPH_H
+#include FT_STROKER_H
+#include FT_OUTLINE_H
+#include FT_TRUETYPE_TABLES_H
 
 #include "parlay.h"
+
+#if PARLAY_USE_THREADS && defined(_WIN32)
+#define PARLAY_THREADS_WIN32 1
+#include <windows.h>
+#elif PARLAY_USE_THREADS
+#define PARLAY_THREADS_POSIX 1
+#include <pthread.h>
+#endif
+
+#if PARLAY_USE_MMAP && defined(_WIN32)
+#define PARLAY_MMAP_WIN32 1
+#include <windows.h>
+#elif PARLAY_USE_MMAP
+#define PARLAY_MMAP_POSIX 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "parlay-internal.h"
+#include "parlay-unicode.h"
 
 #if PARLAY_USE_MINIXML
 #include <mxml.h>
 #endif
 
+#if PARLAY_USE_SIMD && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+#define PARLAY_SIMD_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif PARLAY_USE_SIMD && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define PARLAY_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__)
+#define PARLAY_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PARLAY_TARGET(isa)
+#endif
+
 
 //---------------------------------------------------------------------
 // Section 1: Utility functions
 
-static codepoint_t read_utf8_character(const char** bytes) {
-    const unsigned char* p = (const unsigned char*)*bytes;
-    codepoint_t c;
-    if (*p == 0) {
-        return 0;
-    }
-    if ((*p & 0x80) == 0) {
-        c = *p++;
-    } else if ((*p & 0xE0) == 0xC0) {
-        c = (*p++ & 0x1F) << 6;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+// Text is checked to be valid UTF-8 all at once before any of it is laid
+// out, and then decoded a block at a time.  Most text is mostly ASCII, so
+// runs of it are found and copied across by a SIMD kernel, chosen when the
+// context is created; only the other characters go through the code here.
+// Where it can, the check itself is done by a SIMD kernel too.
+
+// Counts the ASCII bytes at the start of s, eight at a time
+
+static size_t ascii_span_scalar(const unsigned char* s, size_t n, codepoint_t* out) {
+    uint64_t word;
+    size_t i, k;
+    for (i = 0; i + 8 <= n; i += 8) {
+        memcpy(&word,s+i,8);
+        if (word & 0x8080808080808080ULL) {
+            break;
         }
-        c |= (*p++ & 0x3F);
-        if (c < 0x80) {
-            return INVALID_CHARACTER;
+        if (out != NULL) {
+            for (k = 0; k < 8; k++) {
+                out[i+k] = s[i+k];
+            }
+        }
+    }
+    for (; i < n && s[i] < 0x80; i++) {
+        if (out != NULL) {
+            out[i] = s[i];
         }
-    } else if ((*p & 0xF0) == 0xE0) {
-        c = (*p++ & 0x0F) << 12;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+    }
+    return i;
+}
+
+
+// Returns 0 if the n bytes at s are valid UTF-8, or else what's wrong with
+// the first bad sequence, putting its byte offset in *roffset.  Overlong
+// forms, surrogates, and code points above U+10FFFF are all invalid.
+
+static int check_utf8(const unsigned char* s, size_t n, size_t* roffset) {
+    codepoint_t c, min_c;
+    size_t i, k, n_trail;
+    int kind;
+
+    i = 0;
+    while (i < n) {
+        if (s[i] < 0x80) {
+            i += ascii_span_scalar(s+i,n-i,NULL);
+            continue;
         }
-        c |= (*p++ & 0x3F) << 6;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+        if ((s[i] & 0xE0) == 0xC0) {
+            c = s[i] & 0x1F;
+            n_trail = 1;
+            min_c = 0x80;
+        } else if ((s[i] & 0xF0) == 0xE0) {
+            c = s[i] & 0x0F;
+            n_trail = 2;
+            min_c = 0x800;
+        } else if ((s[i] & 0xF8) == 0xF0) {
+            c = s[i] & 0x07;
+            n_trail = 3;
+            min_c = 0x10000;
+        } else {
+            kind = UTF8_BAD_BYTE;
+            goto error;
         }
-        c |= (*p++ & 0x3F);
-        if (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF)) {
-            return INVALID_CHARACTER;
+        for (k = 1; k <= n_trail; k++) {
+            if (i+k >= n || (s[i+k] & 0xC0) != 0x80) {
+                kind = UTF8_TRUNCATED;
+                goto error;
+            }
+            c = (c << 6) | (s[i+k] & 0x3F);
         }
-    } else if ((*p & 0xF8) == 0xF0) {
-        c = (*p++ & 0x07) << 18;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+        if (c < min_c) {
+            kind = UTF8_OVERLONG;
+            goto error;
         }
-        c |= (*p++ & 0x3F) << 12;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+        if (c >= 0xD800 && c <= 0xDFFF) {
+            kind = UTF8_SURROGATE;
+            goto error;
         }
-        c |= (*p++ & 0x3F) << 6;
-        if ((*p & 0xC0) != 0x80) {
-            return INVALID_CHARACTER;
+        if (c > 0x10FFFF) {
+            kind = UTF8_TOO_LARGE;
+            goto error;
         }
-        c |= (*p++ & 0x3F);
-        if (c < 0x10000) {
-            return INVALID_CHARACTER;
+        i += n_trail + 1;
+    }
+    return 0;
+
+error:
+    *roffset = i;
+    return kind;
+}
+
+
+// Decodes up to max code points of text that check_utf8 has passed, moving
+// *rp past them, and returns how many there were
+
+static size_t decode_utf8(const unsigned char** rp, const unsigned char* end, codepoint_t* out, size_t max,
+        AsciiSpanFunction ascii_span) {
+    const unsigned char* p = *rp;
+    size_t n = 0, run;
+
+    while (n < max && p < end) {
+        if (*p < 0x80) {
+            run = (size_t)(end - p);
+            if (run > max - n) {
+                run = max - n;
+            }
+            run = ascii_span(p,run,out+n);
+            p += run;
+            n += run;
+        } else if ((*p & 0xE0) == 0xC0) {
+            out[n++] = ((codepoint_t)(p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+            p += 2;
+        } else if ((*p & 0xF0) == 0xE0) {
+            out[n++] = ((codepoint_t)(p[0] & 0x0F) << 12) | ((codepoint_t)(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+            p += 3;
+        } else {
+            out[n++] = ((codepoint_t)(p[0] & 0x07) << 18) | ((codepoint_t)(p[1] & 0x3F) << 12)
+                    | ((codepoint_t)(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+            p += 4;
         }
-    } else {
-        return INVALID_CHARACTER;
     }
-    *bytes = (const char*)p;
-    return c;
+    *rp = p;
+    return n;
+}
+
+
+// Looks up the line breaking class of a code point in the two-stage table in
+// parlay-unicode.h.  Code points are never above U+10FFFF; check_utf8 won't
+// pass one.
+
+static __inline int get_line_break_class(codepoint_t c) {
+    return line_break_blocks[line_break_index[c >> 7]][c & 127];
 }
 
 
+// Spaces, including the fixed width ones, and the zero width space.  These
+// end a word, and can hang past the wrap width at the end of a line.
+
 static int is_word_break(codepoint_t c) {
-    switch (c) {
-    case '\t':
-    case ' ':
-    case 0x2000:
-    case 0x2001:
-    case 0x2002:
-    case 0x2003:
-    case 0x2004:
-    case 0x2005:
-    case 0x2006:
-    case 0x2008:
-    case 0x2009:
-    case 0x200B:
-    case 0x200C:
-    case 0x200D:
-        return 1;
-    }
-    return 0;
+    int lb_class = get_line_break_class(c);
+    return lb_class == LB_SP || lb_class == LB_ZW;
 }
 
 
@@ -123,6 +233,59 @@ static int is_line_break(codepoint_t c) {
 }
 
 
+static int get_bidi_class(codepoint_t c) {
+    size_t lo = 0, hi = sizeof(bidi_ranges)/sizeof(bidi_ranges[0]), mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (c < bidi_ranges[mid].first) {
+            hi = mid;
+        } else if (c > bidi_ranges[mid].last) {
+            lo = mid + 1;
+        } else {
+            return bidi_ranges[mid].bidi_class;
+        }
+    }
+    return BIDI_L;
+}
+
+
+// Nothing before U+0590 is right-to-left, so most text never gets as far as
+// the table lookup
+
+static __inline int is_rtl_character(codepoint_t c) {
+    int bidi_class;
+    if (c < 0x0590) {
+        return 0;
+    }
+    bidi_class = get_bidi_class(c);
+    return bidi_class == BIDI_R || bidi_class == BIDI_AL;
+}
+
+
+static codepoint_t get_mirror_character(codepoint_t c) {
+    size_t lo = 0, hi = sizeof(mirror_pairs)/sizeof(mirror_pairs[0]), mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (c < mirror_pairs[mid].c) {
+            hi = mid;
+        } else if (c > mirror_pairs[mid].c) {
+            lo = mid + 1;
+        } else {
+            return mirror_pairs[mid].mirror;
+        }
+    }
+    return 0;
+}
+
+
+// Directional marks and the explicit embedding and isolate controls, which
+// take up no space and are never drawn
+
+static int is_bidi_control(codepoint_t c) {
+    return c == 0x061C || c == 0x200E || c == 0x200F || (c >= 0x202A && c <= 0x202E) || (c >= 0x2066 && c <= 0x2069);
+}
+
+
 static int get_hex02_value(const char* hex) {
     int i, rv;
     rv = 0;
@@ -148,429 +311,494 @@ static int get_hex02_value(const char* hex) {
 //---------------------------------------------------------------------
 // Section 2: Font management functions
 
-// I am ashamed of using a linked-list for storing registered fonts, but when you
-// have about ten fonts and they're heavily front-loaded, there's no reason to
-// make this any more complex.  (Just make sure to register the most common fonts
-// first.)
-
-static FontRecord* font_list;
-static FontRecord* font_last;
+// Batch workers are clones of a context, so they go stale when a font is
+// registered or unregistered; they'll be cloned again by the next batch that
+// wants them.
 
-int parlay_register_font(const char* font_name, const char* normal_filename, const char* italic_filename,
-        const char* bold_filename, const char* bold_italic_filename) {
-    size_t alloc_size;
-    FontRecord* font_rec;
-    char* p;
-    int status = 9999;
-    alloc_size = 5 + sizeof(FontRecord) + strlen(font_name);
-    if (normal_filename != NULL) {
-        alloc_size += strlen(normal_filename);
-    }
-    if (italic_filename != NULL) {
-        alloc_size += strlen(italic_filename);
-    }
-    if (bold_filename != NULL) {
-        alloc_size += strlen(bold_filename);
-    }
-    if (bold_italic_filename != NULL) {
-        alloc_size += strlen(bold_italic_filename);
-    }
-    font_rec = malloc(alloc_size);
-    if (font_rec == NULL) {
-        status = 301;
-        goto error;
-    }
-    p = (char*)&font_rec[1];
-    font_rec->name = p;
-    strcpy(p,font_name);
-    p += strlen(p)+1;
-    if (normal_filename) {
-        font_rec->normal_filename = p;
-        strcpy(p,normal_filename);
-        p += strlen(p)+1;
-    } else {
-        font_rec->normal_filename = NULL;
-    }
-    if (italic_filename) {
-        font_rec->italic_filename = p;
-        strcpy(p,italic_filename);
-        p += strlen(p)+1;
-    } else {
-        font_rec->italic_filename = NULL;
-    }
-    if (bold_filename) {
-        font_rec->bold_filename = p;
-        strcpy(p,bold_filename);
-        p += strlen(p)+1;
-    } else {
-        font_rec->bold_filename = NULL;
-    }
-    if (bold_italic_filename) {
-        font_rec->bold_italic_filename = p;
-        strcpy(p,bold_italic_filename);
-    } else {
-        font_rec->bold_italic_filename = NULL;
+static void discard_batch_workers(ParlayContext* ctx) {
+    int i;
+    for (i = 0; i < ctx->n_batch_workers; i++) {
+        parlay_context_delete(ctx->batch_workers[i]);
     }
-    font_rec->next = NULL;
-    if (font_list == NULL) {
-        font_list = font_rec;
-    } else {
-        font_last->next = font_rec;
+    if (ctx->batch_workers != NULL) {
+        free(ctx->batch_workers);
+        ctx->batch_workers = NULL;
     }
-    font_last = font_rec;
-    status = 0;
-error:
-    return status;
+    ctx->n_batch_workers = 0;
 }
 
 
-static FTC_FaceID lookup_face_id(const char* font_name, int font_style) {
-    FontRecord* font_rec;
-    for (font_rec = font_list; font_rec != NULL; font_rec = font_rec->next) {
-        if (!strcmp(font_name,font_rec->name)) {
-            switch (font_style) {
-            case PARLAY_STYLE_NORMAL:
-                return (FTC_FaceID)font_rec->normal_filename;
-            case PARLAY_STYLE_ITALIC:
-                return (FTC_FaceID)font_rec->italic_filename;
-            case PARLAY_STYLE_BOLD:
-                return (FTC_FaceID)font_rec->bold_filename;
-            case PARLAY_STYLE_BOLD_ITALIC:
-                return (FTC_FaceID)font_rec->bold_italic_filename;
-            default:
-                return NULL;
-            }
+// Glyphs laid out to be drawn are kept per context with their bitmaps, so
+// FreeType is asked about a glyph once, not every time it's laid out and
+// again every time it's drawn.  Entries are keyed by the face and size text
+// is set in and either a character or a glyph index; a character's entry
+// says which glyph of which face it came to, after fallbacks.  Bitmaps are
+// copied out of FreeType's caches, which can let them go at any time, except
+// ones in the glyph file, which keeps them as long as the context does.
+//
+// When the cache fills up it's emptied and refilled, and its bitmaps start
+// a new generation.  Anything that changes which glyph a character comes to,
+// like registering a font, empties it too.  Layouts point straight at
+// bitmaps and hold a reference to each generation they point into, so a
+// layout can always be drawn without FreeType, however often the cache has
+// been emptied since it was laid out.
+
+static size_t hash_glyph_cache_key(FTC_FaceID face_id, int font_px, uint32_t key, int by_glyph_index) {
+    size_t h = (size_t)face_id;
+    h = h * 31 + (size_t)font_px;
+    h = h * 31 + (size_t)by_glyph_index;
+    h = h * 31 + key;
+    return h & (GLYPH_CACHE_SLOTS-1);
+}
+
+
+static void release_glyph_bitmaps(GlyphBitmaps* bitmaps) {
+    GlyphCacheChunk* chunk;
+    GlyphCacheChunk* next;
+    if (--bitmaps->n_refs == 0) {
+        for (chunk = bitmaps->chunks; chunk != NULL; chunk = next) {
+            next = chunk->next;
+            free(chunk);
         }
+        free(bitmaps);
     }
-    return NULL;
 }
 
 
-static FT_Error load_face_callback(FTC_FaceID face_id, FT_Library library, FT_Pointer request_data,
-        FT_Face* rface) {
-    return FT_New_Face(library,(char*)face_id,0,rface);
+static void clear_glyph_cache(GlyphCache* cache) {
+    if (cache->slots != NULL && cache->n_entries != 0) {
+        memset(cache->slots,0,GLYPH_CACHE_SLOTS*sizeof(GlyphCacheEntry));
+    }
+    if (cache->bitmaps != NULL) {
+        release_glyph_bitmaps(cache->bitmaps);
+        cache->bitmaps = NULL;
+    }
+    cache->n_entries = 0;
+    cache->n_bytes = 0;
 }
 
 
-//---------------------------------------------------------------------
-// Section 3: Layout functions
-
-static FT_Library library;
-static FTC_Manager manager;
-static FTC_CMapCache cmap_cache;
-static FTC_SBitCache sbit_cache;
-static FTC_ImageCache image_cache;
+static void delete_glyph_cache(GlyphCache* cache) {
+    clear_glyph_cache(cache);
+    if (cache->slots != NULL) {
+        free(cache->slots);
+        cache->slots = NULL;
+    }
+}
 
 
-static int new_layout(size_t n_glyphs_cap, ParlayLayout** rlayout) {
-    ParlayLayout* layout = NULL;
-    ParlayGlyphPlan* glyph_plans = NULL;
-    int status = 9999;
+static const GlyphCacheEntry* find_glyph_cache_entry(const GlyphCache* cache, FTC_FaceID face_id, int font_px,
+        uint32_t key, int by_glyph_index) {
+    const GlyphCacheEntry* entry;
+    size_t h;
 
-    layout = (ParlayLayout*)malloc(sizeof(ParlayLayout));
-    if (layout == NULL) {
-        status = 1001;
-        goto error;
+    if (cache->slots == NULL) {
+        return NULL;
     }
-
-    glyph_plans = (ParlayGlyphPlan*)malloc(sizeof(ParlayGlyphPlan)*n_glyphs_cap);
-    if (glyph_plans == NULL) {
-        status = 1002;
-        goto error;
+    for (h = hash_glyph_cache_key(face_id,font_px,key,by_glyph_index); cache->slots[h].face_id != NULL;
+            h = (h + 1) & (GLYPH_CACHE_SLOTS-1)) {
+        entry = &cache->slots[h];
+        if (entry->key == key && entry->face_id == face_id && entry->font_px == font_px
+                && entry->by_glyph_index == by_glyph_index) {
+            return entry;
+        }
     }
+    return NULL;
+}
 
-    layout->glyph_plans = glyph_plans;
-    layout->n_glyphs_cap = n_glyphs_cap;
-    layout->n_glyphs = 0;
-    layout->first_glyph_of_current_word = 0;
-    layout->first_glyph_of_current_line = 0;
-    layout->glyph_x = 0;
-    layout->line_y_top = 0;
-    layout->height = -1;
-    layout->width = -1;
-    layout->x_image_offset = -9999;
-    layout->y_image_offset = -9999;
-    layout->any_borders = 0;
-    layout->any_highlights = 0;
-
-    *rlayout = layout;
-    layout = NULL;
-    glyph_plans = NULL;
 
-    status = 0;
+// Makes sure n more entries can be added without the cache being emptied,
+// emptying it now if need be, so the entries added for one character can
+// refer to each other.  The bitmaps added after that can take the cache a
+// glyph or two past its byte limit.
 
-error:
-    if (glyph_plans != NULL) {
-        free(glyph_plans);
+static int make_room_in_glyph_cache(GlyphCache* cache, size_t n) {
+    if (cache->slots == NULL) {
+        cache->slots = (GlyphCacheEntry*)calloc(GLYPH_CACHE_SLOTS,sizeof(GlyphCacheEntry));
+        if (cache->slots == NULL) {
+            return 1;
+        }
     }
-    if (layout != NULL) {
-        free(layout);
+    if (cache->n_entries + n > GLYPH_CACHE_SLOTS/4*3 || cache->n_bytes >= GLYPH_CACHE_MAX_BYTES) {
+        clear_glyph_cache(cache);
     }
-    return status;
+    return 0;
 }
 
 
-static int increase_layout_glyph_capacity(ParlayLayout* layout) {
-    ParlayGlyphPlan* glyph_plans = NULL;
-    size_t n_glyphs_cap;
-    int status = 9999;
-
-    n_glyphs_cap = layout->n_glyphs_cap*2;
-    if (n_glyphs_cap < 10) {
-        n_glyphs_cap = 10;
+static const GlyphCacheEntry* add_glyph_cache_entry(GlyphCache* cache, const GlyphCacheEntry* entry) {
+    size_t h;
+    for (h = hash_glyph_cache_key(entry->face_id,entry->font_px,entry->key,entry->by_glyph_index);
+            cache->slots[h].face_id != NULL; h = (h + 1) & (GLYPH_CACHE_SLOTS-1)) {
     }
+    cache->slots[h] = *entry;
+    cache->n_entries++;
+    return &cache->slots[h];
+}
 
-    glyph_plans = (ParlayGlyphPlan*)malloc(sizeof(ParlayGlyphPlan)*n_glyphs_cap);
-    if (glyph_plans == NULL) {
-        status = 1101;
-        goto error;
-    }
 
-    if (layout->glyph_plans) {
-        memcpy(glyph_plans,layout->glyph_plans,layout->n_glyphs*sizeof(ParlayGlyphPlan));
-        free(layout->glyph_plans);
-    }
+// Bitmaps are packed into chunks one after another.  A big one gets a chunk
+// of its own, so it doesn't cut short the chunk being filled.
 
-    layout->glyph_plans = glyph_plans;
-    layout->n_glyphs_cap = n_glyphs_cap;
+static const unsigned char* copy_glyph_bitmap(GlyphCache* cache, const unsigned char* bitmap, size_t n_bytes) {
+    GlyphBitmaps* bitmaps = cache->bitmaps;
+    GlyphCacheChunk* chunk;
+    unsigned char* copy;
+    size_t size;
 
-    glyph_plans = NULL;
+    if (bitmaps == NULL) {
+        bitmaps = (GlyphBitmaps*)malloc(sizeof(GlyphBitmaps));
+        if (bitmaps == NULL) {
+            return NULL;
+        }
+        bitmaps->n_refs = 1;
+        bitmaps->chunks = NULL;
+        cache->bitmaps = bitmaps;
+    }
+    chunk = bitmaps->chunks;
+    if (chunk == NULL || chunk->size - chunk->used < n_bytes) {
+        size = MAX(GLYPH_CACHE_CHUNK_BYTES,n_bytes);
+        chunk = (GlyphCacheChunk*)malloc(sizeof(GlyphCacheChunk) + size);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        chunk->size = size;
+        chunk->used = 0;
+        if (n_bytes > GLYPH_CACHE_CHUNK_BYTES/4 && bitmaps->chunks != NULL) {
+            chunk->next = bitmaps->chunks->next;
+            bitmaps->chunks->next = chunk;
+        } else {
+            chunk->next = bitmaps->chunks;
+            bitmaps->chunks = chunk;
+        }
+    }
+    copy = (unsigned char*)&chunk[1] + chunk->used;
+    memcpy(copy,bitmap,n_bytes);
+    chunk->used += n_bytes;
+    cache->n_bytes += n_bytes;
+    return copy;
+}
 
-    status = 0;
 
-error:
-    if (glyph_plans == NULL) {
-        free(glyph_plans);
+// Registered fonts are kept in an array, where a font's handle is its index
+// plus one, and are found by name through a hash table.  A name keeps
+// its handle for the life of the context, even if the font is replaced or
+// unregistered and registered again, and a clone gives every name the same
+// handle it has here.
+//
+// The face IDs FreeType caches by point to the face sources in a font record,
+// and layouts and caches can hold on to them, so a record that's replaced
+// isn't freed until the context is, and an unregistered record stays where it
+// is.  Their faces are closed, but they can still be opened again if an old
+// layout is rendered.
+
+static size_t hash_font_name(const char* font_name) {
+    size_t h = 0;
+    while (*font_name) {
+        h = h * 31 + (unsigned char)*font_name++;
     }
-    return status;
+    return h % FONT_REGISTRY_BUCKETS;
 }
 
 
-static void lay_out_line(ParlayLayout* layout, int empty_line_height, int empty_line_ascender) {
-    size_t i;
-    int this_line_y, this_line_ascender, this_line_descender, this_line_height;
-    this_line_ascender = empty_line_ascender;
-    this_line_descender = empty_line_height - empty_line_ascender;
-    for (i = layout->first_glyph_of_current_line; i < layout->n_glyphs; i++) {
-        int glyph_ascender = layout->glyph_plans[i].ascender;
-        int glyph_descender = layout->glyph_plans[i].line_height - glyph_ascender;
-        this_line_ascender = MAX(glyph_ascender,this_line_ascender);
-        this_line_descender = MAX(glyph_descender,this_line_descender);
+static FontRecord* find_font_record(const ParlayContext* ctx, const char* font_name) {
+    FontRecord* font_rec;
+    if (ctx->font_buckets == NULL) {
+        return NULL;
     }
-    this_line_height = this_line_ascender + this_line_descender;
-    this_line_y = layout->line_y_top - this_line_ascender;
-    for (i = layout->first_glyph_of_current_line; i < layout->n_glyphs; i++) {
-        layout->glyph_plans[i].y = this_line_y;
-        layout->glyph_plans[i].line_height = this_line_height;
-        layout->glyph_plans[i].ascender = this_line_ascender;
+    for (font_rec = ctx->font_buckets[hash_font_name(font_name)]; font_rec != NULL; font_rec = font_rec->next) {
+        if (!strcmp(font_name,font_rec->name)) {
+            return font_rec;
+        }
     }
-    layout->first_glyph_of_current_line = layout->n_glyphs;
-    layout->first_glyph_of_current_word = layout->n_glyphs;
-    layout->line_y_top = this_line_y - this_line_descender;
-    layout->glyph_x = 0;
+    return NULL;
 }
 
 
-static void lay_out_most_of_line(ParlayLayout* layout) {
-    size_t i;
-    int this_line_y, this_line_ascender, this_line_descender, this_line_height, this_line_width;
-    if (layout->first_glyph_of_current_line == layout->first_glyph_of_current_word) {
-        return;
+static FontRecord* lookup_font_record(ParlayContext* ctx, const char* font_name) {
+    FontRecord* font_rec = find_font_record(ctx,font_name);
+    if (font_rec == NULL || !font_rec->registered) {
+        return NULL;
     }
-    this_line_ascender = 0;
-    this_line_descender = 0;
-    for (i = layout->first_glyph_of_current_line; i < layout->first_glyph_of_current_word; i++) {
-        int glyph_ascender = layout->glyph_plans[i].ascender;
-        int glyph_descender = layout->glyph_plans[i].line_height - glyph_ascender;
-        this_line_ascender = MAX(glyph_ascender,this_line_ascender);
-        this_line_descender = MAX(glyph_descender,this_line_descender);
+    return font_rec;
+}
+
+
+static FontRecord* lookup_font_handle(ParlayContext* ctx, ParlayFontHandle font_handle) {
+    FontRecord* font_rec;
+    if (font_handle == 0 || font_handle > ctx->n_fonts) {
+        return NULL;
     }
-    this_line_height = this_line_ascender + this_line_descender;
-    this_line_y = layout->line_y_top - this_line_ascender;
-    for (i = layout->first_glyph_of_current_line; i < layout->first_glyph_of_current_word; i++) {
-        layout->glyph_plans[i].y = this_line_y;
-        layout->glyph_plans[i].line_height = this_line_height;
-        layout->glyph_plans[i].ascender = this_line_ascender;
+    font_rec = ctx->fonts[font_handle-1];
+    if (!font_rec->registered) {
+        return NULL;
     }
-    this_line_width = layout->glyph_plans[layout->first_glyph_of_current_word].x;
-    for (i = layout->first_glyph_of_current_word; i < layout->n_glyphs; i++) {
-        layout->glyph_plans[i].x -= this_line_width;
+    return font_rec;
+}
+
+
+// Closes a font's faces in the cache manager.  Nothing else needs to be
+// flushed: its face IDs are never given to another font.
+
+static void close_font_faces(ParlayContext* ctx, FontRecord* font_rec) {
+    int i;
+    for (i = 0; i < 4; i++) {
+        if (font_rec->faces[i].filename != NULL || font_rec->faces[i].data != NULL) {
+            FTC_Manager_RemoveFaceID(ctx->manager,(FTC_FaceID)&font_rec->faces[i]);
+        }
     }
-    layout->first_glyph_of_current_line = layout->first_glyph_of_current_word;
-    layout->line_y_top = this_line_y - this_line_descender;
-    layout->glyph_x -= this_line_width;
+    ctx->face_memo.font_rec = NULL;
 }
 
 
-static int add_text_to_layout(ParlayLayout* layout, const char** text_handle,
-        const ParlayStyle* style, int wrap_width, int collapse_whitespace, size_t max_characters) {
+// Mapped files are shared by every context in the process, so the list of
+// them is, and is locked when threads are used
 
-    FTC_FaceID face_id;
-    FT_Face face;
-    FTC_ScalerRec face_size_info;
-    FT_Size size;
-    int font_px, line_height, ascender;
-    int prev_was_whitespace;
-    int c_is_sbit, c_xadvance, c_width, c_height, c_left, c_top;
-    codepoint_t c;
-    FTC_SBit sbit;
-    FT_BitmapGlyph glyph;
-    FT_UInt glyph_index;
-    //FT_UInt prev_glyph_index;
-    //FT_Vector kerning;
-    ParlayGlyphPlan* gp;
-    int status = 9999;
-    size_t ichr;
+static MappedFile* mapped_files = NULL;
 
-    face_id = lookup_face_id(style->font_name,style->font_style);
-    if (face_id == NULL) {
-        status = 1201;
-        goto error;
+#if PARLAY_THREADS_WIN32
+static SRWLOCK mapped_files_lock = SRWLOCK_INIT;
+#define lock_mapped_files() AcquireSRWLockExclusive(&mapped_files_lock)
+#define unlock_mapped_files() ReleaseSRWLockExclusive(&mapped_files_lock)
+#elif PARLAY_THREADS_POSIX
+static pthread_mutex_t mapped_files_lock = PTHREAD_MUTEX_INITIALIZER;
+#define lock_mapped_files() pthread_mutex_lock(&mapped_files_lock)
+#define unlock_mapped_files() pthread_mutex_unlock(&mapped_files_lock)
+#else
+#define lock_mapped_files()
+#define unlock_mapped_files()
+#endif
+
+
+// Maps a whole file into memory read-only, or reads it into memory without
+// mmap.  Returns nonzero if it can't.
+
+static int map_file(const char* filename, const unsigned char** rdata, size_t* rsize) {
+#if PARLAY_MMAP_WIN32
+    HANDLE file, mapping;
+    LARGE_INTEGER size;
+    void* data = NULL;
+
+    // Sharing writes lets a glyph file be appended to while it's mapped
+    file = CreateFileA(filename,GENERIC_READ,FILE_SHARE_READ|FILE_SHARE_WRITE,NULL,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return 1;
+    }
+    if (GetFileSizeEx(file,&size) && size.QuadPart > 0 && (unsigned long long)size.QuadPart <= SIZE_MAX) {
+        mapping = CreateFileMappingA(file,NULL,PAGE_READONLY,0,0,NULL);
+        if (mapping != NULL) {
+            data = MapViewOfFile(mapping,FILE_MAP_READ,0,0,0);
+            CloseHandle(mapping);
+        }
     }
+    CloseHandle(file);
+    if (data == NULL) {
+        return 1;
+    }
+    *rdata = (const unsigned char*)data;
+    *rsize = (size_t)size.QuadPart;
+    return 0;
+#elif PARLAY_MMAP_POSIX
+    struct stat st;
+    void* data = MAP_FAILED;
+    int fd;
 
-    status = FTC_Manager_LookupFace(manager,face_id,&face);
-    if (status) {
-        status = 1202;
-        goto error;
+    fd = open(filename,O_RDONLY);
+    if (fd < 0) {
+        return 1;
+    }
+    if (fstat(fd,&st) == 0 && st.st_size > 0 && (unsigned long long)st.st_size <= SIZE_MAX) {
+        data = mmap(NULL,(size_t)st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+    }
+    close(fd);
+    if (data == MAP_FAILED) {
+        return 1;
+    }
+    *rdata = (const unsigned char*)data;
+    *rsize = (size_t)st.st_size;
+    return 0;
+#else
+    FILE* f;
+    unsigned char* data = NULL;
+    long size;
+
+    f = fopen(filename,"rb");
+    if (f == NULL) {
+        return 1;
+    }
+    if (fseek(f,0,SEEK_END) == 0 && (size = ftell(f)) > 0 && fseek(f,0,SEEK_SET) == 0) {
+        data = (unsigned char*)malloc((size_t)size);
+        if (data != NULL && fread(data,1,(size_t)size,f) != (size_t)size) {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(f);
+    if (data == NULL) {
+        return 1;
     }
+    *rdata = data;
+    *rsize = (size_t)size;
+    return 0;
+#endif
+}
 
-    font_px = (int)ceil(style->font_size * style->font_scaler);
 
-    face_size_info.face_id = face_id;
-    face_size_info.width = font_px;
-    face_size_info.height = font_px;
-    face_size_info.pixel = 1;
-    face_size_info.x_res = 0;
-    face_size_info.y_res = 0;
+static void unmap_file(const unsigned char* data, size_t size) {
+#if PARLAY_MMAP_WIN32
+    (void)size;
+    UnmapViewOfFile(data);
+#elif PARLAY_MMAP_POSIX
+    munmap((void*)data,size);
+#else
+    (void)size;
+    free((void*)data);
+#endif
+}
 
-    status = FTC_Manager_LookupSize(manager,&face_size_info,&size);
-    if (status) {
-        status = 1203;
-        goto error;
-    }
 
-    line_height = (int)((float)face->height * size->metrics.x_ppem / face->units_per_EM + 0.5);
-    ascender = (int)((float)face->ascender * size->metrics.x_ppem / face->units_per_EM + 0.5);
+// Finds the mapping of a file, mapping it if no context has yet, and takes a
+// reference to it.  Files are known by the name they were registered with.
 
-    //prev_glyph_index = 0;
-    prev_was_whitespace = 0;
+static MappedFile* retain_mapped_file(const char* filename) {
+    MappedFile* mapped_file;
 
-    for (ichr = 0; ichr < max_characters; ichr++) {
-        c = read_utf8_character(text_handle);
-        if (c == INVALID_CHARACTER) {
-            status = 1205;
-            goto error;
-        }
-        if (c == 0) {
+    lock_mapped_files();
+    for (mapped_file = mapped_files; mapped_file != NULL; mapped_file = mapped_file->next) {
+        if (!strcmp(mapped_file->filename,filename)) {
             break;
         }
-        if (collapse_whitespace) {
-            if (is_collapsable_whitespace(c)) {
-                if (prev_was_whitespace || layout->glyph_x == 0) {
-                    continue;
-                }
-                c = ' ';
-                prev_was_whitespace = 1;
+    }
+    if (mapped_file == NULL) {
+        mapped_file = (MappedFile*)malloc(sizeof(MappedFile) + strlen(filename) + 1);
+        if (mapped_file != NULL) {
+            if (map_file(filename,&mapped_file->data,&mapped_file->size)) {
+                free(mapped_file);
+                mapped_file = NULL;
             } else {
-                prev_was_whitespace = 0;
+                strcpy((char*)&mapped_file[1],filename);
+                mapped_file->filename = (const char*)&mapped_file[1];
+                mapped_file->n_refs = 0;
+                mapped_file->next = mapped_files;
+                mapped_files = mapped_file;
             }
-        } else if (is_line_break(c)) {
-            lay_out_line(layout,line_height,ascender);
-            //prev_glyph_index = 0;
-            continue;
         }
-        glyph_index = FTC_CMapCache_Lookup(cmap_cache,face_id,0,c);
-        if (glyph_index == 0) {
-            glyph_index = FTC_CMapCache_Lookup(cmap_cache,face_id,0,'?');
+    }
+    if (mapped_file != NULL) {
+        mapped_file->n_refs++;
+    }
+    unlock_mapped_files();
+    return mapped_file;
+}
+
+
+static void release_mapped_file(MappedFile* mapped_file) {
+    MappedFile** link;
+
+    lock_mapped_files();
+    if (--mapped_file->n_refs == 0) {
+        for (link = &mapped_files; *link != mapped_file; link = &(*link)->next) {
         }
-        status = FTC_SBitCache_LookupScaler(sbit_cache,&face_size_info,FT_LOAD_RENDER,glyph_index,&sbit,NULL);
-        if (status) {
-            status = 1207;
+        *link = mapped_file->next;
+        unmap_file(mapped_file->data,mapped_file->size);
+        free(mapped_file);
+    }
+    unlock_mapped_files();
+}
+
+
+// Adds a font made of the given face sources, one per style, to the
+// registry.  Filenames are copied into the record, and the record takes its
+// own reference to any mapped files.  Registering a name that's already
+// registered replaces the font, keeping its handle.
+
+static int add_font_record(ParlayContext* ctx, const char* font_name, const FaceSource* sources) {
+    size_t alloc_size, fonts_cap, h;
+    FontRecord* font_rec = NULL;
+    FontRecord* old_rec;
+    FontRecord** fonts;
+    FontRecord** link;
+    char* p;
+    int i;
+    int status = 9999;
+
+    if (ctx->font_buckets == NULL) {
+        ctx->font_buckets = (FontRecord**)calloc(FONT_REGISTRY_BUCKETS,sizeof(FontRecord*));
+        if (ctx->font_buckets == NULL) {
+            status = 303;
             goto error;
         }
-        if (sbit->xadvance != 0 || sbit->height != 0) {
-            c_is_sbit = 1;
-            c_xadvance = sbit->xadvance;
-            c_width = sbit->width;
-            c_height = sbit->height;
-            c_left = sbit->left;
-            c_top = sbit->top;
-        } else {
-            status = FTC_ImageCache_LookupScaler(image_cache,&face_size_info,FT_LOAD_RENDER,glyph_index,(FT_Glyph*)&glyph,NULL);
-            if (status) {
-                status = 1208;
-                goto error;
-            }
-            c_is_sbit = 0;
-            c_xadvance = glyph->root.advance.x >> 16;
-            c_width = glyph->bitmap.width;
-            c_height = glyph->bitmap.rows;
-            c_left = glyph->left;
-            c_top = glyph->top;
+    }
+    old_rec = find_font_record(ctx,font_name);
+    if (old_rec == NULL && ctx->n_fonts == ctx->fonts_cap) {
+        fonts_cap = ctx->fonts_cap*2;
+        if (fonts_cap < 16) {
+            fonts_cap = 16;
         }
-        if (layout->n_glyphs >= layout->n_glyphs_cap) {
-            status = increase_layout_glyph_capacity(layout);
-            if (status) {
-                status = 1209;
-                goto error;
-            }
+        fonts = (FontRecord**)realloc(ctx->fonts,fonts_cap*sizeof(FontRecord*));
+        if (fonts == NULL) {
+            status = 304;
+            goto error;
         }
-        gp = &layout->glyph_plans[layout->n_glyphs];
-        gp->is_sbit = c_is_sbit;
-        gp->line_height = line_height;
-        gp->x = layout->glyph_x;
-        gp->y = 0;
-        gp->ascender = ascender;
-        gp->advance = c_xadvance;
-        gp->highlight = style->highlight;
-        if (gp->highlight) {
-            layout->any_highlights = 1;
-            memcpy(gp->highlight_color,style->highlight_color,4*sizeof(float));
-        }
-        gp->underline = style->underline;
-        if (c_height != 0) {
-            // if (prev_glyph_index != 0) {
-            //    status = FT_Get_Kerning(face,glyph_index,prev_glyph_index,FT_KERNING_DEFAULT,&kerning);
-            //    if (status) {
-            //        status = 1208;
-            //        goto error;
-            //    }
-            //    layout->next_glyph_x += kerning.x>>6;
-            // }
-            gp->face_id = face_id;
-            gp->font_px = font_px;
-            gp->glyph_index = glyph_index;
-            gp->left = c_left;
-            gp->width = c_width;
-            gp->top = c_top;
-            gp->height = c_height;
-            memcpy(gp->text_color,style->text_color,4*sizeof(float));
-            gp->border_thickness = style->border_thickness;
-            if (style->border_thickness) {
-                memcpy(gp->border_color,style->border_color,4*sizeof(float));
-                layout->any_borders = 1;
-            }
-        } else {
-            gp->face_id = NULL;
-            gp->glyph_index = 0;
-            // The rest shouldn't be needed, here as failsafe
-            gp->left = 0;
-            gp->width = 0;
-            gp->top = 0;
-            gp->height = 0;
-            gp->border_thickness = 0;
-        }
-        layout->n_glyphs++;
-        layout->glyph_x += gp->advance;
-        if (is_word_break(c)) {
-            layout->first_glyph_of_current_word = layout->n_glyphs;
-        } else {
-            if (wrap_width > 0 && gp->x + gp->left + gp->width + gp->border_thickness > wrap_width) {
-                lay_out_most_of_line(layout);
-            }
+        ctx->fonts = fonts;
+        ctx->fonts_cap = fonts_cap;
+    }
+
+    alloc_size = 1 + sizeof(FontRecord) + strlen(font_name);
+    for (i = 0; i < 4; i++) {
+        if (sources[i].filename != NULL) {
+            alloc_size += strlen(sources[i].filename) + 1;
+        }
+    }
+    font_rec = malloc(alloc_size);
+    if (font_rec == NULL) {
+        status = 301;
+        goto error;
+    }
+    p = (char*)&font_rec[1];
+    font_rec->name = p;
+    strcpy(p,font_name);
+    p += strlen(p)+1;
+    for (i = 0; i < 4; i++) {
+        font_rec->faces[i] = sources[i];
+        if (sources[i].filename != NULL) {
+            font_rec->faces[i].filename = p;
+            strcpy(p,sources[i].filename);
+            p += strlen(p)+1;
+        }
+        if (sources[i].mapped_file != NULL) {
+            lock_mapped_files();
+            sources[i].mapped_file->n_refs++;
+            unlock_mapped_files();
         }
-        //prev_glyph_index = glyph_index;
     }
+    font_rec->registered = 1;
+    font_rec->fallbacks = NULL;
+    font_rec->n_fallbacks = 0;
+    memset(font_rec->coverage,0,sizeof(font_rec->coverage));
+
+    h = hash_font_name(font_name);
+    if (old_rec != NULL) {
+        for (link = &ctx->font_buckets[h]; *link != old_rec; link = &(*link)->next) {
+        }
+        *link = old_rec->next;
+        font_rec->handle = old_rec->handle;
+        font_rec->fallbacks = old_rec->fallbacks;
+        font_rec->n_fallbacks = old_rec->n_fallbacks;
+        old_rec->fallbacks = NULL;
+        old_rec->n_fallbacks = 0;
+        close_font_faces(ctx,old_rec);
+        old_rec->next = ctx->retired_fonts;
+        ctx->retired_fonts = old_rec;
+    } else {
+        font_rec->handle = (ParlayFontHandle)(++ctx->n_fonts);
+    }
+    ctx->fonts[font_rec->handle-1] = font_rec;
+    font_rec->next = ctx->font_buckets[h];
+    ctx->font_buckets[h] = font_rec;
+    discard_batch_workers(ctx);
+    clear_glyph_cache(&ctx->glyph_cache);
+
     status = 0;
 
 error:
@@ -578,515 +806,6078 @@ error:
 }
 
 
-static void get_x_glyph_bounds(ParlayLayout* layout, int* pleft, int* pright) {
-    int i, left, right;
-    if (layout->n_glyphs == 0) {
-        *pleft = *pright = 0;
-        return;
-    }
-    left = INT_MAX;
-    right = INT_MIN;
-    for (i = 0; i < layout->n_glyphs; i++) {
-        ParlayGlyphPlan* gp = &layout->glyph_plans[i];
-        if (gp->glyph_index != 0) {
-            left = MIN(left,gp->x+gp->left-gp->border_thickness);
-            right = MAX(right,gp->x+gp->left+gp->width+gp->border_thickness);
-        }
-    }
-    *pleft = left;
-    *pright = right;
+int parlay_context_register_font(ParlayContext* ctx, const char* font_name, const char* normal_filename, const char* italic_filename,
+        const char* bold_filename, const char* bold_italic_filename) {
+    FaceSource sources[4];
+
+    memset(sources,0,sizeof(sources));
+    sources[PARLAY_STYLE_NORMAL].filename = normal_filename;
+    sources[PARLAY_STYLE_ITALIC].filename = italic_filename;
+    sources[PARLAY_STYLE_BOLD].filename = bold_filename;
+    sources[PARLAY_STYLE_BOLD_ITALIC].filename = bold_italic_filename;
+    return add_font_record(ctx,font_name,sources);
 }
 
 
-static void get_y_glyph_bounds(ParlayLayout* layout, int* pbottom, int* ptop) {
-    int i, bottom, top;
-    if (layout->n_glyphs == 0) {
-        *pbottom = *ptop = 0;
-        return;
-    }
-    bottom = INT_MAX;
-    top = INT_MIN;
-    for (i = 0; i < layout->n_glyphs; i++) {
-        ParlayGlyphPlan* gp = &layout->glyph_plans[i];
-        if (gp->glyph_index != 0) {
-            top = MAX(top,gp->y+gp->top+gp->border_thickness);
-            bottom = MIN(bottom,gp->y+gp->top+gp->height-gp->border_thickness);
-        }
-    }
-    *pbottom = bottom;
-    *ptop = top;
-}
-
+// Registers a font from font files already in memory, such as ones read out
+// of a pack file, so faces are never opened from the filesystem.  The bytes
+// are the caller's, and must stay where they are until the context is
+// deleted, since a face can be opened again after the cache lets it go.  A
+// null pointer or zero size means the font doesn't have that style.
 
-static int finalize_layout(ParlayLayout* layout, int cropping_strategy, int fixed_width) {
-    int top, bottom, left, right;
-    ParlayGlyphPlan* gp;
-    size_t k;
+int parlay_context_register_font_memory(ParlayContext* ctx, const char* font_name, const void* normal_data,
+        size_t normal_size, const void* italic_data, size_t italic_size, const void* bold_data, size_t bold_size,
+        const void* bold_italic_data, size_t bold_italic_size) {
+    FaceSource sources[4];
 
-    if (layout->first_glyph_of_current_line != layout->n_glyphs) {
-        lay_out_line(layout,0,0);
+    memset(sources,0,sizeof(sources));
+    if (normal_data != NULL && normal_size != 0) {
+        sources[PARLAY_STYLE_NORMAL].data = (const unsigned char*)normal_data;
+        sources[PARLAY_STYLE_NORMAL].size = normal_size;
+    }
+    if (italic_data != NULL && italic_size != 0) {
+        sources[PARLAY_STYLE_ITALIC].data = (const unsigned char*)italic_data;
+        sources[PARLAY_STYLE_ITALIC].size = italic_size;
+    }
+    if (bold_data != NULL && bold_size != 0) {
+        sources[PARLAY_STYLE_BOLD].data = (const unsigned char*)bold_data;
+        sources[PARLAY_STYLE_BOLD].size = bold_size;
     }
+    if (bold_italic_data != NULL && bold_italic_size != 0) {
+        sources[PARLAY_STYLE_BOLD_ITALIC].data = (const unsigned char*)bold_italic_data;
+        sources[PARLAY_STYLE_BOLD_ITALIC].size = bold_italic_size;
+    }
+    return add_font_record(ctx,font_name,sources);
+}
 
-    switch (cropping_strategy & PARLAY_CROP_X_MASK) {
-    case PARLAY_CROP_X_NATURAL:
-        left = 0;
-        right = 0;
-        for (k = 0; k < layout->n_glyphs; k++) {
-            gp = &layout->glyph_plans[k];
-            right = MAX(right,gp->x+gp->advance);
-        }
-        break;
 
-    case PARLAY_CROP_X_TIGHT:
-        get_x_glyph_bounds(layout,&left,&right);
-        break;
+// Registers a font whose files are mapped into memory now, once for the
+// whole process, so every context and thread that registers the same files
+// shares one mapping and faces are opened from memory.  Unlike
+// parlay_context_register_font, a missing file is an error here.
 
-    case PARLAY_CROP_X_WIDTH:
-        if (fixed_width == 0) {
-            return 1403;
-        }
-        get_x_glyph_bounds(layout,&left,&right);
-        right = left + fixed_width;
-        break;
+int parlay_context_register_mapped_font(ParlayContext* ctx, const char* font_name, const char* normal_filename,
+        const char* italic_filename, const char* bold_filename, const char* bold_italic_filename) {
+    FaceSource sources[4];
+    int i;
+    int status = 9999;
 
-    case PARLAY_CROP_X_FAILSAFE:
-        get_x_glyph_bounds(layout,&left,&right);
-        left = MIN(left,0);
-        for (k = 0; k < layout->n_glyphs; k++) {
-            gp = &layout->glyph_plans[k];
-            right = MAX(right,gp->x+gp->advance);
+    memset(sources,0,sizeof(sources));
+    sources[PARLAY_STYLE_NORMAL].filename = normal_filename;
+    sources[PARLAY_STYLE_ITALIC].filename = italic_filename;
+    sources[PARLAY_STYLE_BOLD].filename = bold_filename;
+    sources[PARLAY_STYLE_BOLD_ITALIC].filename = bold_italic_filename;
+    for (i = 0; i < 4; i++) {
+        if (sources[i].filename != NULL) {
+            sources[i].mapped_file = retain_mapped_file(sources[i].filename);
+            if (sources[i].mapped_file == NULL) {
+                status = 305;
+                goto error;
+            }
+            sources[i].data = sources[i].mapped_file->data;
+            sources[i].size = sources[i].mapped_file->size;
         }
-        break;
-
-    default:
-        return 1401;
     }
+    status = add_font_record(ctx,font_name,sources);
 
-    switch (cropping_strategy & PARLAY_CROP_Y_MASK) {
-    case PARLAY_CROP_Y_NATURAL:
-        top = 0;
-        if (layout->n_glyphs > 0) {
-            gp = &layout->glyph_plans[layout->n_glyphs-1];
-            bottom = gp->y+gp->ascender-gp->line_height;
-        } else {
-            bottom = 0;
-        }
-        break;
-
-    case PARLAY_CROP_Y_TIGHT:
-        get_y_glyph_bounds(layout,&bottom,&top);
-        break;
-
-    case PARLAY_CROP_Y_HEIGHT:
-        return 1404;
-
-    case PARLAY_CROP_Y_FAILSAFE:
-        get_y_glyph_bounds(layout,&bottom,&top);
-        top = MAX(top,0);
-        if (layout->n_glyphs > 0) {
-            gp = &layout->glyph_plans[layout->n_glyphs-1];
-            bottom = MIN(bottom,gp->y+gp->ascender-gp->line_height);
+error:
+    for (i = 0; i < 4; i++) {
+        if (sources[i].mapped_file != NULL) {
+            release_mapped_file(sources[i].mapped_file);
         }
-        break;
-
-    default:
-        return 1402;
     }
+    return status;
+}
 
-    layout->height = top - bottom;
-    layout->y_image_offset = top;
-    layout->width = right - left;
-    layout->x_image_offset = left;
 
-    layout->first_glyph_of_current_word = (size_t)(-1);
-    layout->first_glyph_of_current_line = (size_t)(-1);
-    layout->glyph_x = -1;
-    layout->line_y_top = -1;
+// The name keeps its handle, which finds nothing until the name is
+// registered again
 
+int parlay_context_unregister_font(ParlayContext* ctx, const char* font_name) {
+    FontRecord* font_rec = lookup_font_record(ctx,font_name);
+    if (font_rec == NULL) {
+        return 311;
+    }
+    font_rec->registered = 0;
+    close_font_faces(ctx,font_rec);
+    discard_batch_workers(ctx);
+    clear_glyph_cache(&ctx->glyph_cache);
     return 0;
 }
 
 
-static void delete_layout(ParlayLayout* layout) {
-    if (layout != NULL) {
-        if (layout->glyph_plans != NULL) {
-            free(layout->glyph_plans);
-        }
-        free(layout);
+// A handle saves looking the font up by name for every run of text.  Put it
+// in ParlayStyle's font_handle and set font_name to NULL; a font_name always
+// wins, so the handle is only looked at when there's no name.
+
+int parlay_context_get_font_handle(ParlayContext* ctx, const char* font_name, ParlayFontHandle* rfont_handle) {
+    FontRecord* font_rec = lookup_font_record(ctx,font_name);
+    if (font_rec == NULL) {
+        return 321;
     }
+    *rfont_handle = font_rec->handle;
+    return 0;
 }
 
 
-static int realign(ParlayLayout* layout, int text_alignment) {
-    size_t i, j, first_glyph, last_glyph;
-    int line_y, shift;
+// Sets the fonts a font falls back on, in order, for characters it doesn't
+// have, such as a CJK font and then an emoji font after a Latin one.  The
+// fallbacks are kept by handle, so they follow a fallback font that's
+// replaced, and are skipped while it's unregistered.  Fallbacks don't fall
+// back any further.  Setting no fallbacks clears them.
 
-    switch (text_alignment) {
-    case PARLAY_ALIGN_LEFT:
-        // do nothing
-        break;
+int parlay_context_set_font_fallbacks(ParlayContext* ctx, const char* font_name, const char* const* fallback_names,
+        int n_fallbacks) {
+    FontRecord* font_rec;
+    FontRecord* fallback;
+    ParlayFontHandle* fallbacks = NULL;
+    int i;
+    int status = 9999;
 
-    case PARLAY_ALIGN_CENTER:
-    case PARLAY_ALIGN_RIGHT:
-        i = 0;
-        while (i < layout->n_glyphs) {
-            first_glyph = i;
-            line_y = layout->glyph_plans[i].y;
-            last_glyph = i;
-            i++;
-            while (i < layout->n_glyphs && layout->glyph_plans[i].y == line_y) {
-                if (layout->glyph_plans[i].face_id != NULL) {
-                    last_glyph = i;
-                }
-                i++;
-            }
-            shift = layout->width - layout->glyph_plans[last_glyph].x - layout->glyph_plans[last_glyph].width;
-            if (text_alignment == PARLAY_ALIGN_CENTER) {
-                shift /= 2;
-            }
-            if (shift > 0) {
-                for (j = first_glyph; j <= last_glyph; j++) {
-                    layout->glyph_plans[j].x += shift;
-                }
+    font_rec = lookup_font_record(ctx,font_name);
+    if (font_rec == NULL) {
+        status = 331;
+        goto error;
+    }
+    if (n_fallbacks > 0) {
+        fallbacks = (ParlayFontHandle*)malloc(n_fallbacks*sizeof(ParlayFontHandle));
+        if (fallbacks == NULL) {
+            status = 332;
+            goto error;
+        }
+        for (i = 0; i < n_fallbacks; i++) {
+            fallback = lookup_font_record(ctx,fallback_names[i]);
+            if (fallback == NULL) {
+                status = 333;
+                goto error;
             }
+            fallbacks[i] = fallback->handle;
         }
-        break;
+    }
+    if (font_rec->fallbacks != NULL) {
+        free(font_rec->fallbacks);
+    }
+    font_rec->fallbacks = fallbacks;
+    font_rec->n_fallbacks = n_fallbacks > 0 ? n_fallbacks : 0;
+    fallbacks = NULL;
+    discard_batch_workers(ctx);
+    clear_glyph_cache(&ctx->glyph_cache);
 
-    default:
-        return 1301;
+    status = 0;
+
+error:
+    if (fallbacks != NULL) {
+        free(fallbacks);
     }
+    return status;
+}
 
-    return 0;
+
+static void free_font_record(FontRecord* font_rec) {
+    int i;
+    for (i = 0; i < 4; i++) {
+        if (font_rec->faces[i].mapped_file != NULL) {
+            release_mapped_file(font_rec->faces[i].mapped_file);
+        }
+    }
+    if (font_rec->fallbacks != NULL) {
+        free(font_rec->fallbacks);
+    }
+    for (i = 0; i < 4; i++) {
+        if (font_rec->coverage[i] != NULL) {
+            free(font_rec->coverage[i]);
+        }
+    }
+    free(font_rec);
 }
 
 
-static void transfer_rect(ParlayLayout* layout, int x, int y, int width, int height, const float rgb[3], float alpha, float* work) {
-    int i, j, imax, jmax;
-    size_t iw;
-    float source_alpha, rem_alpha, total_alpha;
+static FTC_FaceID get_style_face_id(const FontRecord* font_rec, int font_style) {
+    const FaceSource* source;
+    if (font_style < PARLAY_STYLE_NORMAL || font_style > PARLAY_STYLE_BOLD_ITALIC) {
+        return NULL;
+    }
+    source = &font_rec->faces[font_style];
+    if (source->filename == NULL && source->data == NULL) {
+        return NULL;
+    }
+    return (FTC_FaceID)source;
+}
+
 
-    imax = (int)MAX(0,MIN(width,layout->width-x));
-    jmax = (int)MAX(0,MIN(height,layout->height-y));
-    for (i = MAX(0,-x); i < imax; i++) {
-        for (j = MAX(0,-y); j < jmax; j++) {
-            iw = ((y+j) * layout->width + (x+i)) * 4;
-            source_alpha = alpha;
-            rem_alpha = (1-source_alpha)*work[iw+3];
-            total_alpha = source_alpha + rem_alpha;
-            source_alpha /= total_alpha;
-            rem_alpha /= total_alpha;
-            work[iw+0] = rgb[0]*source_alpha + work[iw+0]*rem_alpha;
-            work[iw+1] = rgb[1]*source_alpha + work[iw+1]*rem_alpha;
-            work[iw+2] = rgb[2]*source_alpha + work[iw+2]*rem_alpha;
-            work[iw+3] = total_alpha;
-        }
+static FT_Error load_face_callback(FTC_FaceID face_id, FT_Library library, FT_Pointer request_data,
+        FT_Face* rface) {
+    const FaceSource* source = (const FaceSource*)face_id;
+    if (source->data != NULL) {
+        return FT_New_Memory_Face(library,source->data,(FT_Long)source->size,0,rface);
     }
+    return FT_New_Face(library,source->filename,0,rface);
 }
 
 
-static void smear_rect(ParlayLayout* layout, int x, int y, int width, int height, const float rgb[3], float alpha, int bt, float* work) {
-    int i, j;
-    float r;
-    if (bt == 0) {
-        return;
+// Reads which characters a face has from its charmap, which lists them in
+// order, so it's gone through once to count the pages and again to fill them
+// in.  A face that can't be opened gets a coverage with nothing in it, so it
+// isn't opened again for every character.
+
+static Coverage* build_coverage(ParlayContext* ctx, FTC_FaceID face_id) {
+    Coverage* coverage;
+    FT_Face face = NULL;
+    FT_ULong c;
+    FT_UInt glyph_index;
+    size_t n_pages = 0, page, last_page;
+
+    if (FTC_Manager_LookupFace(ctx->manager,face_id,&face)) {
+        face = NULL;
     }
-    for (i = -bt; i <= bt; i++) {
-        for (j = -bt; j <= bt; j++) {
-            r = sqrt(i*i+j*j);
-            if (r <= bt) {
-                transfer_rect(layout,x+i,y+j,width,height,rgb,alpha,work);
-            } else if (r <= bt+1) {
-                transfer_rect(layout,x+i,y+j,width,height,rgb,alpha*(bt+1-r),work);
+    if (face != NULL) {
+        last_page = (size_t)-1;
+        for (c = FT_Get_First_Char(face,&glyph_index); glyph_index != 0; c = FT_Get_Next_Char(face,c,&glyph_index)) {
+            page = c >> COVERAGE_PAGE_SHIFT;
+            if (c < 0x110000 && page != last_page) {
+                n_pages++;
+                last_page = page;
+            }
+        }
+    }
+
+    coverage = (Coverage*)malloc(sizeof(Coverage) + (n_pages+1)*COVERAGE_PAGE_BYTES);
+    if (coverage == NULL) {
+        return NULL;
+    }
+    memset(coverage->page_index,0,sizeof(coverage->page_index));
+    coverage->pages = (unsigned char*)&coverage[1];
+    memset(coverage->pages,0,(n_pages+1)*COVERAGE_PAGE_BYTES);
+    coverage->n_pages = 0;
+    if (face != NULL) {
+        for (c = FT_Get_First_Char(face,&glyph_index); glyph_index != 0; c = FT_Get_Next_Char(face,c,&glyph_index)) {
+            page = c >> COVERAGE_PAGE_SHIFT;
+            if (c >= 0x110000) {
+                continue;
+            }
+            if (coverage->page_index[page] == 0) {
+                if (coverage->n_pages == n_pages) {
+                    break;
+                }
+                coverage->page_index[page] = (unsigned short)(++coverage->n_pages);
             }
+            coverage->pages[coverage->page_index[page]*COVERAGE_PAGE_BYTES + ((c >> 3) & (COVERAGE_PAGE_BYTES-1))]
+                |= (unsigned char)(1 << (c & 7));
         }
     }
+    return coverage;
+}
+
+
+static __inline int has_character(const Coverage* coverage, codepoint_t c) {
+    const unsigned char* page = &coverage->pages[coverage->page_index[c >> COVERAGE_PAGE_SHIFT]*COVERAGE_PAGE_BYTES];
+    return (page[(c >> 3) & (COVERAGE_PAGE_BYTES-1)] >> (c & 7)) & 1;
 }
 
 
-static void transfer_buffer(ParlayLayout* layout, unsigned char* buffer, int x, int y, int width, int height, const float rgb[3], float alpha, float* work) {
-    int i, j, imax, jmax;
-    size_t ig, iw;
-    float source_alpha, rem_alpha, total_alpha;
+// Looks for a character a font doesn't have in the fonts it falls back on,
+// trying each one's face in the same style, or its normal face if it doesn't
+// have that style.  A font's coverage is found the first time it's needed,
+// after which passing over a font without the character is a bit test.
+// Returns the glyph index, or 0 if none of them have it.
+
+static FT_UInt get_fallback_glyph(ParlayContext* ctx, const FontRecord* font_rec, int font_style, codepoint_t c,
+        FTC_FaceID* rface_id) {
+    FontRecord* fallback;
+    FTC_FaceID face_id;
+    FT_UInt glyph_index;
+    int i, style;
 
-    imax = (int)MAX(0,MIN(width,layout->width-x));
-    jmax = (int)MAX(0,MIN(height,layout->height-y));
-    for (i = MAX(0,-x); i < imax; i++) {
-        for (j = MAX(0,-y); j < jmax; j++) {
-            ig = j * width + i;
-            if (buffer[ig] != 0) {
-                iw = ((y+j) * layout->width + (x+i)) * 4;
-                source_alpha = (buffer[ig]/255.0f) * alpha;
-                rem_alpha = (1-source_alpha)*work[iw+3];
-                total_alpha = source_alpha + rem_alpha;
-                source_alpha /= total_alpha;
-                rem_alpha /= total_alpha;
-                work[iw+0] = rgb[0]*source_alpha + work[iw+0]*rem_alpha;
-                work[iw+1] = rgb[1]*source_alpha + work[iw+1]*rem_alpha;
-                work[iw+2] = rgb[2]*source_alpha + work[iw+2]*rem_alpha;
-                work[iw+3] = total_alpha;
+    if (c >= 0x110000) {
+        return 0;
+    }
+    for (i = 0; i < font_rec->n_fallbacks; i++) {
+        fallback = lookup_font_handle(ctx,font_rec->fallbacks[i]);
+        if (fallback == NULL) {
+            continue;
+        }
+        style = font_style;
+        face_id = get_style_face_id(fallback,style);
+        if (face_id == NULL) {
+            style = PARLAY_STYLE_NORMAL;
+            face_id = get_style_face_id(fallback,style);
+            if (face_id == NULL) {
+                continue;
+            }
+        }
+        if (fallback->coverage[style] == NULL) {
+            fallback->coverage[style] = build_coverage(ctx,face_id);
+            if (fallback->coverage[style] == NULL) {
+                continue;
             }
         }
+        if (!has_character(fallback->coverage[style],c)) {
+            continue;
+        }
+        glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,face_id,0,c);
+        if (glyph_index != 0) {
+            *rface_id = face_id;
+            return glyph_index;
+        }
     }
+    return 0;
 }
 
 
-static void smear_buffer(ParlayLayout* layout, unsigned char* buffer, int x, int y, int width, int height, const float rgb[3], float alpha, int bt, float* work) {
-    int i, j;
-    float r;
-    if (bt == 0) {
-        return;
-    }
-    for (i = -bt; i <= bt; i++) {
-        for (j = -bt; j <= bt; j++) {
-            r = sqrt(i*i+j*j);
-            if (r <= bt) {
-                transfer_buffer(layout,buffer,x+i,y+j,width,height,rgb,alpha,work);
-            } else if (r <= bt+1) {
-                transfer_buffer(layout,buffer,x+i,y+j,width,height,rgb,alpha*(bt+1-r),work);
-            }
+// Finds the glyph a character comes to in a font: the font's own, or else a
+// fallback's, or else the font's question mark.  The face it's in is stored
+// in rface_id.
+
+static FT_UInt find_character_glyph(ParlayContext* ctx, const FontRecord* font_rec, int font_style, FTC_FaceID face_id,
+        codepoint_t c, FTC_FaceID* rface_id) {
+    FT_UInt glyph_index;
+
+    *rface_id = face_id;
+    glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,face_id,0,c);
+    if (glyph_index == 0) {
+        glyph_index = get_fallback_glyph(ctx,font_rec,font_style,c,rface_id);
+        if (glyph_index == 0) {
+            glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,face_id,0,'?');
         }
     }
+    return glyph_index;
 }
 
 
-static void transfer_underline(ParlayLayout* layout, const ParlayGlyphPlan* gp, int underline_x, int underline_y, int underline_descender, float* work, int smear) {
-    int y = -underline_y + underline_descender/2;
-    int width = gp->x + gp->advance - underline_x;
-    int height = MIN((underline_descender+4)/5,1);
-    if (smear) {
-        smear_rect(layout,underline_x,y,width,height,gp->border_color,gp->border_color[3],gp->border_thickness,work);
-    } else {
-        transfer_rect(layout,underline_x,y,width,height,gp->text_color,gp->text_color[3],work);
+//---------------------------------------------------------------------
+// Section 3: Layout functions
+
+// Lets go of the glyph bitmaps a layout's glyphs point at
+
+static void release_layout_bitmaps(ParlayLayout* layout) {
+    size_t i;
+    for (i = 0; i < layout->n_bitmaps; i++) {
+        release_glyph_bitmaps(layout->bitmaps[i]);
     }
+    layout->n_bitmaps = 0;
 }
 
 
-static int rasterize(ParlayLayout* layout, const float background_color[4], ParlayRGBARawImage* image) {
-    unsigned char* data = NULL;
-    float* work = NULL;
-    int x, y;
-    size_t k, m;
-    ParlayGlyphPlan* gp;
-    FTC_ScalerRec face_size_info;
-    FTC_SBit sbit;
-    FT_BitmapGlyph glyph;
-    unsigned char* c_buffer;
-    int underlining, underline_x = 0, underline_y = 0, underline_descender = 0;
-    int status = 9999;
+// Empties a layout so it can be reused, keeping its glyph plan array
 
-    face_size_info.pixel = 1;
-    face_size_info.x_res = 0;
-    face_size_info.y_res = 0;
+static void reset_layout(ParlayLayout* layout) {
+    release_layout_bitmaps(layout);
+    layout->n_glyphs = 0;
+    layout->first_glyph_of_current_word = 0;
+    layout->first_glyph_of_current_line = 0;
+    layout->glyph_x = 0;
+    layout->line_y_top = 0;
+    layout->height = -1;
+    layout->width = -1;
+    layout->x_image_offset = -9999;
+    layout->y_image_offset = -9999;
+    layout->any_borders = 0;
+    layout->any_highlights = 0;
+    layout->text_alignment = PARLAY_ALIGN_LEFT;
+    layout->fixed_width = 0;
+    layout->opacity = 1.0f;
+    layout->metrics_only = 0;
+    layout->kerning = 0;
+    layout->line_breaking = PARLAY_BREAK_GREEDY;
+    layout->any_rtl = 0;
+    layout->first_glyph_of_current_paragraph = 0;
+    layout->prev_face_id = NULL;
+    layout->prev_font_px = 0;
+    layout->prev_glyph_index = 0;
+    layout->prev_line_break_class = LB_WJ;
+    layout->line_break_after_spaces = 0;
+    layout->drawn = 0;
+}
 
-    data = malloc(layout->height*layout->width*4);
-    if (data == NULL) {
-        status = 1901;
+
+static int new_layout(size_t n_glyphs_cap, ParlayLayout** rlayout) {
+    ParlayLayout* layout = NULL;
+    ParlayGlyphPlan* glyph_plans = NULL;
+    int status = 9999;
+
+    layout = (ParlayLayout*)malloc(sizeof(ParlayLayout));
+    if (layout == NULL) {
+        status = 1001;
         goto error;
     }
 
-    work = malloc(layout->height * layout->width * 4 * sizeof(float));
-    if (work == NULL) {
-        status = 1902;
+    glyph_plans = (ParlayGlyphPlan*)malloc(sizeof(ParlayGlyphPlan)*n_glyphs_cap);
+    if (glyph_plans == NULL) {
+        status = 1002;
         goto error;
     }
 
-    for (k = 0; k < (size_t)(layout->width * layout->height * 4); k++) {
-        work[k] = background_color[k%4];
+    layout->glyph_plans = glyph_plans;
+    layout->n_glyphs_cap = n_glyphs_cap;
+    layout->bitmaps = NULL;
+    layout->n_bitmaps_cap = 0;
+    layout->n_bitmaps = 0;
+    layout->ctx = NULL;
+    layout->drawn_plans = NULL;
+    layout->n_drawn_cap = 0;
+    layout->n_drawn = 0;
+    reset_layout(layout);
+
+    *rlayout = layout;
+    layout = NULL;
+    glyph_plans = NULL;
+
+    status = 0;
+
+error:
+    if (glyph_plans != NULL) {
+        free(glyph_plans);
+    }
+    if (layout != NULL) {
+        free(layout);
     }
+    return status;
+}
 
-    if (layout->any_highlights) {
-        for (k = 0; k < layout->n_glyphs; k++) {
-            gp = &layout->glyph_plans[k];
-            if (!gp->highlight) {
-                continue;
-            }
-            y = layout->y_image_offset - (gp->y + gp->ascender);
-            x = gp->x - layout->x_image_offset;
-            transfer_rect(layout,x,y,gp->advance,gp->line_height,gp->highlight_color,gp->highlight_color[3],work);
-        }
+
+static int increase_layout_glyph_capacity(ParlayLayout* layout) {
+    ParlayGlyphPlan* glyph_plans = NULL;
+    size_t n_glyphs_cap;
+    int status = 9999;
+
+    n_glyphs_cap = layout->n_glyphs_cap*2;
+    if (n_glyphs_cap < 10) {
+        n_glyphs_cap = 10;
     }
 
-    for (m = layout->any_borders ? 0 : 1; m < 2; m++) {
-        underlining = 0;
-        for (k = 0; k < layout->n_glyphs; k++) {
-            gp = &layout->glyph_plans[k];
-            if (gp->face_id == NULL) {
-                continue;
-            }
-            face_size_info.face_id = gp->face_id;
-            face_size_info.width = gp->font_px;
-            face_size_info.height = gp->font_px;
-            if (gp->is_sbit) {
-                status = FTC_SBitCache_LookupScaler(sbit_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,&sbit,NULL);
-                if (status) {
-                    status = 1903;
-                    goto error;
-                }
-                c_buffer = sbit->buffer;
-            } else {
-                status = FTC_ImageCache_LookupScaler(image_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,(FT_Glyph*)&glyph,NULL);
-                if (status) {
-                    status = 1903;
-                    goto error;
-                }
-                c_buffer = glyph->bitmap.buffer;
-            }
-            y = layout->y_image_offset - (gp->y + gp->top);
-            x = (gp->x + gp->left) - layout->x_image_offset;
-            if (m == 0) {
-                smear_buffer(layout,c_buffer,x,y,gp->width,gp->height,gp->border_color,gp->border_color[3],gp->border_thickness,work);
-            } else {
-                transfer_buffer(layout,c_buffer,x,y,gp->width,gp->height,gp->text_color,gp->text_color[3],work);
-            }
-            if (underlining) {
-                if (!gp->underline || gp->y != underline_y || gp->line_height-gp->ascender != underline_descender) {
-                    transfer_underline(layout,gp,underline_x,underline_y,underline_descender,work,m==0);
-                    if (gp->underline) {
-                        underline_x = gp->x;
-                        underline_y = gp->y;
-                        underline_descender = gp->line_height-gp->ascender;
-                    } else {
-                        underlining = 0;
-                    }
-                }
-            } else if (gp->underline) {
-                underlining = 1;
-                underline_x = gp->x;
-                underline_y = gp->y;
-                underline_descender = gp->line_height-gp->ascender;
-            }
-        }
-        if (underlining) {
-            transfer_underline(layout,gp,underline_x,underline_y,underline_descender,work,m==0);
-        }
+    glyph_plans = (ParlayGlyphPlan*)malloc(sizeof(ParlayGlyphPlan)*n_glyphs_cap);
+    if (glyph_plans == NULL) {
+        status = 1101;
+        goto error;
     }
 
-    for (k = 0; k < (size_t)(layout->width * layout->height * 4); k++) {
-        data[k] = (unsigned char)(work[k] * 255.0);
+    if (layout->glyph_plans) {
+        memcpy(glyph_plans,layout->glyph_plans,layout->n_glyphs*sizeof(ParlayGlyphPlan));
+        free(layout->glyph_plans);
     }
 
-    image->data = data;
-    image->height = layout->height;
-    image->width = layout->width;
-    image->x0 = layout->x_image_offset;
-    image->y0 = layout->y_image_offset;
+    layout->glyph_plans = glyph_plans;
+    layout->n_glyphs_cap = n_glyphs_cap;
 
-    data = NULL;
+    glyph_plans = NULL;
+
+    status = 0;
+
+error:
+    if (glyph_plans == NULL) {
+        free(glyph_plans);
+    }
+    return status;
+}
+
+
+// Takes a reference to the glyph cache's current bitmaps for a layout that
+// has just been given one of them, unless it has one already.  The cache
+// only ever moves on to new generations, so that would be the last one it
+// took.
+
+static int hold_glyph_bitmaps(ParlayContext* ctx, ParlayLayout* layout) {
+    GlyphBitmaps* bitmaps = ctx->glyph_cache.bitmaps;
+    GlyphBitmaps** held;
+    size_t n_bitmaps_cap;
+
+    if (bitmaps == NULL || (layout->n_bitmaps > 0 && layout->bitmaps[layout->n_bitmaps-1] == bitmaps)) {
+        return 0;
+    }
+    if (layout->n_bitmaps >= layout->n_bitmaps_cap) {
+        n_bitmaps_cap = MAX(4,layout->n_bitmaps_cap*2);
+        held = (GlyphBitmaps**)realloc(layout->bitmaps,n_bitmaps_cap*sizeof(GlyphBitmaps*));
+        if (held == NULL) {
+            return 1;
+        }
+        layout->bitmaps = held;
+        layout->n_bitmaps_cap = n_bitmaps_cap;
+    }
+    layout->bitmaps[layout->n_bitmaps++] = bitmaps;
+    bitmaps->n_refs++;
+    return 0;
+}
+
+
+static void lay_out_line(ParlayLayout* layout, int empty_line_height, int empty_line_ascender) {
+    size_t i;
+    int this_line_y, this_line_ascender, this_line_descender, this_line_height;
+    this_line_ascender = empty_line_ascender;
+    this_line_descender = empty_line_height - empty_line_ascender;
+    for (i = layout->first_glyph_of_current_line; i < layout->n_glyphs; i++) {
+        int glyph_ascender = layout->glyph_plans[i].ascender;
+        int glyph_descender = layout->glyph_plans[i].line_height - glyph_ascender;
+        this_line_ascender = MAX(glyph_ascender,this_line_ascender);
+        this_line_descender = MAX(glyph_descender,this_line_descender);
+    }
+    this_line_height = this_line_ascender + this_line_descender;
+    this_line_y = layout->line_y_top - this_line_ascender;
+    for (i = layout->first_glyph_of_current_line; i < layout->n_glyphs; i++) {
+        layout->glyph_plans[i].y = this_line_y;
+        layout->glyph_plans[i].line_height = this_line_height;
+        layout->glyph_plans[i].ascender = this_line_ascender;
+    }
+    layout->first_glyph_of_current_line = layout->n_glyphs;
+    layout->first_glyph_of_current_word = layout->n_glyphs;
+    layout->line_y_top = this_line_y - this_line_descender;
+    layout->glyph_x = 0;
+}
+
+
+// Ends the current line before glyph end, giving the glyphs on it the height
+// and baseline of the line.  Their x positions are left alone.
+
+static void close_line(ParlayLayout* layout, size_t end) {
+    size_t i;
+    int this_line_y, this_line_ascender, this_line_descender, this_line_height;
+    this_line_ascender = 0;
+    this_line_descender = 0;
+    for (i = layout->first_glyph_of_current_line; i < end; i++) {
+        int glyph_ascender = layout->glyph_plans[i].ascender;
+        int glyph_descender = layout->glyph_plans[i].line_height - glyph_ascender;
+        this_line_ascender = MAX(glyph_ascender,this_line_ascender);
+        this_line_descender = MAX(glyph_descender,this_line_descender);
+    }
+    this_line_height = this_line_ascender + this_line_descender;
+    this_line_y = layout->line_y_top - this_line_ascender;
+    for (i = layout->first_glyph_of_current_line; i < end; i++) {
+        layout->glyph_plans[i].y = this_line_y;
+        layout->glyph_plans[i].line_height = this_line_height;
+        layout->glyph_plans[i].ascender = this_line_ascender;
+    }
+    layout->first_glyph_of_current_line = end;
+    layout->line_y_top = this_line_y - this_line_descender;
+}
+
+
+static void lay_out_most_of_line(ParlayLayout* layout) {
+    size_t i;
+    int this_line_width;
+    if (layout->first_glyph_of_current_line == layout->first_glyph_of_current_word) {
+        return;
+    }
+    close_line(layout,layout->first_glyph_of_current_word);
+    this_line_width = layout->glyph_plans[layout->first_glyph_of_current_word].x;
+    for (i = layout->first_glyph_of_current_word; i < layout->n_glyphs; i++) {
+        layout->glyph_plans[i].x -= this_line_width;
+    }
+    layout->glyph_x -= this_line_width;
+}
+
+
+// Optimal line breaking lays a paragraph out as one long line, then picks
+// the breaks that minimize the sum of the squares of the space left at the
+// end of each line but the last, as in Knuth and Plass's total-fit method
+// with no stretching.  Breaks can go wherever the greedy wrap could have
+// put them.  Each possible line start is only tried against the line ends
+// that fit after it, so the work grows with the number of words in the
+// paragraph times the number of words on a line.  A word too wide for any
+// line gets a line to itself, the same as with greedy wrapping.
+
+static int break_lines_optimally(ParlayLayout* layout, int wrap_width) {
+    ParlayGlyphPlan* glyph_plans = layout->glyph_plans;
+    size_t first = layout->first_glyph_of_current_line, n = layout->n_glyphs;
+    size_t* starts = NULL;
+    size_t* prev;
+    size_t* breaks;
+    double* costs;
+    int* rights;
+    double cost, slack;
+    size_t m, i, j, k, t, end;
+    int x0, right;
+    int status = 9999;
+
+    if (n - first < 2) {
+        return 0;
+    }
+
+    m = 0;
+    for (k = first; k < n; k++) {
+        if (k == first || glyph_plans[k].break_before) {
+            m++;
+        }
+    }
+    if (m < 2) {
+        return 0;
+    }
+
+    // candidate line starts, with the end of the paragraph as the last one
+    starts = (size_t*)malloc((m+1)*(3*sizeof(size_t) + sizeof(double) + sizeof(int)));
+    if (starts == NULL) {
+        status = 1;
+        goto error;
+    }
+    prev = &starts[m+1];
+    breaks = &prev[m+1];
+    costs = (double*)&breaks[m+1];
+    rights = (int*)&costs[m+1];
+
+    // the right edge of the ink of each word, and whatever follows it up to
+    // the next line start, so lines are measured a word at a time
+    m = 0;
+    for (k = first; k < n; k++) {
+        if (k == first || glyph_plans[k].break_before) {
+            starts[m++] = k;
+            rights[m-1] = INT_MIN;
+        }
+        if (glyph_plans[k].face_id != NULL) {
+            ParlayGlyphPlan* gp = &glyph_plans[k];
+            rights[m-1] = MAX(rights[m-1],gp->x + gp->left + gp->width + gp->border_thickness);
+        }
+    }
+    starts[m] = n;
+    costs[0] = 0.0;
+    for (t = 1; t <= m; t++) {
+        costs[t] = HUGE_VAL;
+    }
+
+    for (i = 0; i < m; i++) {
+        if (costs[i] == HUGE_VAL) {
+            continue;
+        }
+        x0 = glyph_plans[starts[i]].x;
+        right = 0;
+        for (t = i+1; t <= m; t++) {
+            if (rights[t-1] != INT_MIN) {
+                right = MAX(right,rights[t-1] - x0);
+            }
+            if (right > wrap_width) {
+                if (t > i+1) {
+                    break;
+                }
+                cost = OVERFULL_LINE_COST;
+            } else if (t == m) {
+                cost = 0.0;
+            } else {
+                slack = wrap_width - right;
+                cost = slack*slack;
+            }
+            if (costs[i] + cost < costs[t]) {
+                costs[t] = costs[i] + cost;
+                prev[t] = i;
+            }
+            if (right > wrap_width) {
+                break;
+            }
+        }
+    }
+
+    // Follow the best breaks back from the end, putting the line starts in
+    // order at the end of the breaks array, then lay out every line but the
+    // last.  Each glyph is moved exactly once.
+    j = m;
+    for (t = m; t > 0; t = prev[t]) {
+        breaks[--j] = starts[prev[t]];
+    }
+    for (k = j; k < m; k++) {
+        x0 = glyph_plans[breaks[k]].x;
+        end = k+1 < m ? breaks[k+1] : n;
+        for (i = breaks[k]; i < end; i++) {
+            glyph_plans[i].x -= x0;
+        }
+        if (end < n) {
+            close_line(layout,end);
+        } else {
+            layout->glyph_x -= x0;
+        }
+    }
+
+    status = 0;
+
+error:
+    if (starts != NULL) {
+        free(starts);
+    }
+    return status;
+}
+
+
+// Glyph metrics for measuring are cached per context, keyed like FreeType's
+// own caches.  When the cache fills up it is emptied and refilled.
+
+static size_t hash_metrics_key(FTC_FaceID face_id, FT_UInt glyph_index, int font_px) {
+    size_t h = (size_t)face_id;
+    h = h * 31 + glyph_index;
+    h = h * 31 + (size_t)font_px;
+    return h % METRICS_CACHE_BUCKETS;
+}
+
+
+static void clear_metrics_cache(MetricsCache* cache) {
+    MetricsRecord* rec;
+    MetricsRecord* next;
+    size_t k;
+    if (cache->buckets == NULL) {
+        return;
+    }
+    for (k = 0; k < METRICS_CACHE_BUCKETS; k++) {
+        for (rec = cache->buckets[k]; rec != NULL; rec = next) {
+            next = rec->next;
+            free(rec);
+        }
+        cache->buckets[k] = NULL;
+    }
+    cache->n_records = 0;
+}
+
+
+static void delete_metrics_cache(MetricsCache* cache) {
+    clear_metrics_cache(cache);
+    if (cache->buckets != NULL) {
+        free(cache->buckets);
+        cache->buckets = NULL;
+    }
+}
+
+
+// Gets a glyph's advance and bitmap box without rendering it.  FreeType 2.10
+// and later fill in the bitmap size and offset an outline would render to
+// when it's loaded; older versions get it from the grid-fitted control box,
+// which is usually but not always the same.  The advance is rounded the way
+// the sbit or image cache would have rounded it, depending on which of them
+// the glyph would have come from.
+
+static int get_glyph_metrics(ParlayContext* ctx, FTC_Scaler scaler, FT_UInt glyph_index, MetricsRecord** rrec) {
+    MetricsCache* cache = &ctx->metrics_cache;
+    MetricsRecord* rec = NULL;
+    FT_Size size;
+    FT_GlyphSlot slot;
+    size_t h;
+    int xadvance;
+#if FREETYPE_MAJOR == 2 && FREETYPE_MINOR < 10
+    FT_BBox cbox;
+#endif
+    int status = 9999;
+
+    if (cache->buckets == NULL) {
+        cache->buckets = (MetricsRecord**)calloc(METRICS_CACHE_BUCKETS,sizeof(MetricsRecord*));
+        if (cache->buckets == NULL) {
+            status = 1;
+            goto error;
+        }
+    }
+
+    h = hash_metrics_key(scaler->face_id,glyph_index,scaler->width);
+    for (rec = cache->buckets[h]; rec != NULL; rec = rec->next) {
+        if (rec->face_id == scaler->face_id && rec->glyph_index == glyph_index && rec->font_px == (int)scaler->width) {
+            *rrec = rec;
+            return 0;
+        }
+    }
+
+    if (FTC_Manager_LookupSize(ctx->manager,scaler,&size)) {
+        status = 2;
+        goto error;
+    }
+    if (FT_Load_Glyph(size->face,glyph_index,FT_LOAD_DEFAULT)) {
+        status = 3;
+        goto error;
+    }
+    slot = size->face->glyph;
+
+    if (cache->n_records >= METRICS_CACHE_MAX_RECORDS) {
+        clear_metrics_cache(cache);
+    }
+
+    rec = (MetricsRecord*)malloc(sizeof(MetricsRecord));
+    if (rec == NULL) {
+        status = 4;
+        goto error;
+    }
+    rec->face_id = scaler->face_id;
+    rec->glyph_index = glyph_index;
+    rec->font_px = scaler->width;
+
+#if FREETYPE_MAJOR == 2 && FREETYPE_MINOR < 10
+    if (slot->format == FT_GLYPH_FORMAT_OUTLINE) {
+        FT_Outline_Get_CBox(&slot->outline,&cbox);
+        cbox.xMin &= -64;
+        cbox.yMin &= -64;
+        cbox.xMax = (cbox.xMax + 63) & -64;
+        cbox.yMax = (cbox.yMax + 63) & -64;
+        rec->width = (int)((cbox.xMax - cbox.xMin) >> 6);
+        rec->height = (int)((cbox.yMax - cbox.yMin) >> 6);
+        rec->left = (int)(cbox.xMin >> 6);
+        rec->top = (int)(cbox.yMax >> 6);
+    } else
+#endif
+    {
+        rec->width = slot->bitmap.width;
+        rec->height = slot->bitmap.rows;
+        rec->left = slot->bitmap_left;
+        rec->top = slot->bitmap_top;
+    }
+
+    // these are the limits of FreeType's small bitmap cache (the pitch of a
+    // gray bitmap is its width)
+
+    xadvance = (int)((slot->advance.x + 32) >> 6);
+    if (rec->width <= 127 && rec->height <= 255 && rec->left >= -128 && rec->left <= 127
+            && rec->top >= -128 && rec->top <= 127 && xadvance >= -128 && xadvance <= 127) {
+        rec->is_sbit = 1;
+        rec->xadvance = xadvance;
+    } else {
+        rec->is_sbit = 0;
+        rec->xadvance = (int)(slot->advance.x >> 6);
+    }
+
+    rec->next = cache->buckets[h];
+    cache->buckets[h] = rec;
+    cache->n_records++;
+    *rrec = rec;
+    rec = NULL;
+
+    status = 0;
+
+error:
+    if (rec != NULL) {
+        free(rec);
+    }
+    return status;
+}
+
+
+// Kerning pairs are cached per context the same way, so FreeType is only
+// asked about each pair once per face and size
+
+static size_t hash_kerning_key(FTC_FaceID face_id, int font_px, FT_UInt left_glyph, FT_UInt right_glyph) {
+    size_t h = (size_t)face_id;
+    h = h * 31 + (size_t)font_px;
+    h = h * 31 + left_glyph;
+    h = h * 31 + right_glyph;
+    return h % KERNING_CACHE_BUCKETS;
+}
+
+
+static void clear_kerning_cache(KerningCache* cache) {
+    KerningRecord* rec;
+    KerningRecord* next;
+    size_t k;
+    if (cache->buckets == NULL) {
+        return;
+    }
+    for (k = 0; k < KERNING_CACHE_BUCKETS; k++) {
+        for (rec = cache->buckets[k]; rec != NULL; rec = next) {
+            next = rec->next;
+            free(rec);
+        }
+        cache->buckets[k] = NULL;
+    }
+    cache->n_records = 0;
+}
+
+
+static void delete_kerning_cache(KerningCache* cache) {
+    clear_kerning_cache(cache);
+    if (cache->buckets != NULL) {
+        free(cache->buckets);
+        cache->buckets = NULL;
+    }
+}
+
+
+// Gets the kerning between two glyphs, grid-fitted and rounded to pixels.
+// FreeType reads it from the font's kern table.
+
+static int get_kerning(ParlayContext* ctx, FTC_Scaler scaler, FT_UInt left_glyph, FT_UInt right_glyph, int* rkerning) {
+    KerningCache* cache = &ctx->kerning_cache;
+    KerningRecord* rec;
+    FT_Size size;
+    FT_Vector delta;
+    size_t h;
+
+    if (cache->buckets == NULL) {
+        cache->buckets = (KerningRecord**)calloc(KERNING_CACHE_BUCKETS,sizeof(KerningRecord*));
+        if (cache->buckets == NULL) {
+            return 1;
+        }
+    }
+
+    h = hash_kerning_key(scaler->face_id,scaler->width,left_glyph,right_glyph);
+    for (rec = cache->buckets[h]; rec != NULL; rec = rec->next) {
+        if (rec->face_id == scaler->face_id && rec->font_px == (int)scaler->width
+                && rec->left_glyph == left_glyph && rec->right_glyph == right_glyph) {
+            *rkerning = rec->kerning;
+            return 0;
+        }
+    }
+
+    if (FTC_Manager_LookupSize(ctx->manager,scaler,&size)) {
+        return 2;
+    }
+    if (FT_Get_Kerning(size->face,left_glyph,right_glyph,FT_KERNING_DEFAULT,&delta)) {
+        return 3;
+    }
+
+    if (cache->n_records >= KERNING_CACHE_MAX_RECORDS) {
+        clear_kerning_cache(cache);
+    }
+
+    rec = (KerningRecord*)malloc(sizeof(KerningRecord));
+    if (rec == NULL) {
+        return 4;
+    }
+    rec->face_id = scaler->face_id;
+    rec->font_px = scaler->width;
+    rec->left_glyph = left_glyph;
+    rec->right_glyph = right_glyph;
+    rec->kerning = (int)((delta.x + 32) >> 6);
+    rec->next = cache->buckets[h];
+    cache->buckets[h] = rec;
+    cache->n_records++;
+
+    *rkerning = rec->kerning;
+    return 0;
+}
+
+
+// A glyph file keeps rendered glyphs from one run of a program to the next,
+// so glyphs in it are never rendered by FreeType again.  A glyph renders the
+// same for the same font, size, and FreeType version, and the file's header
+// takes care of the version.  The font is known by a hash of what's in its
+// head table, which changes whenever the font does, along with its names and
+// number of glyphs.  Fonts without a head table (anything but TrueType and
+// OpenType) aren't kept in the file.
+
+static uint64_t hash_bytes(uint64_t h, const void* data, size_t n) {
+    const unsigned char* p = (const unsigned char*)data;
+    size_t i;
+    for (i = 0; i < n; i++) {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+
+static int get_glyph_file_key(ParlayContext* ctx, FTC_FaceID face_id, uint64_t* rkey) {
+    FaceSource* source = (FaceSource*)face_id;
+    FT_Face face;
+    TT_Header* head;
+    uint64_t h;
+
+    if (source->glyph_file_key_state == 0) {
+        source->glyph_file_key_state = -1;
+        if (FTC_Manager_LookupFace(ctx->manager,face_id,&face) == 0 && FT_IS_SFNT(face)
+                && (head = (TT_Header*)FT_Get_Sfnt_Table(face,FT_SFNT_HEAD)) != NULL) {
+            h = 14695981039346656037ULL;
+            h = hash_bytes(h,&head->CheckSum_Adjust,sizeof(head->CheckSum_Adjust));
+            h = hash_bytes(h,head->Created,sizeof(head->Created));
+            h = hash_bytes(h,head->Modified,sizeof(head->Modified));
+            h = hash_bytes(h,&face->num_glyphs,sizeof(face->num_glyphs));
+            h = hash_bytes(h,&face->units_per_EM,sizeof(face->units_per_EM));
+            if (face->family_name != NULL) {
+                h = hash_bytes(h,face->family_name,strlen(face->family_name)+1);
+            }
+            if (face->style_name != NULL) {
+                h = hash_bytes(h,face->style_name,strlen(face->style_name)+1);
+            }
+            source->glyph_file_key = h;
+            source->glyph_file_key_state = 1;
+        }
+    }
+    *rkey = source->glyph_file_key;
+    return source->glyph_file_key_state > 0;
+}
+
+
+static size_t hash_glyph_file_key(uint64_t face_key, int font_px, FT_UInt glyph_index) {
+    size_t h = (size_t)face_key;
+    h = h * 31 + (size_t)font_px;
+    h = h * 31 + glyph_index;
+    return h % GLYPH_FILE_BUCKETS;
+}
+
+
+static size_t glyph_file_bitmap_bytes(const GlyphFileRecord* rec) {
+    return ((size_t)rec->width * rec->height + 7) & ~(size_t)7;
+}
+
+
+static void insert_glyph_file_entry(GlyphFile* file, GlyphFileEntry* entry) {
+    size_t h = hash_glyph_file_key(entry->rec.face_key,entry->rec.font_px,entry->rec.glyph_index);
+    entry->next = file->buckets[h];
+    file->buckets[h] = entry;
+}
+
+
+static const GlyphFileEntry* find_glyph_file_entry(ParlayContext* ctx, FTC_FaceID face_id, int font_px,
+        FT_UInt glyph_index) {
+    GlyphFileEntry* entry;
+    uint64_t face_key;
+
+    if (ctx->glyph_file == NULL || !get_glyph_file_key(ctx,face_id,&face_key)) {
+        return NULL;
+    }
+    for (entry = ctx->glyph_file->buckets[hash_glyph_file_key(face_key,font_px,glyph_index)]; entry != NULL;
+            entry = entry->next) {
+        if (entry->rec.face_key == face_key && entry->rec.glyph_index == glyph_index && entry->rec.font_px == font_px) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+
+// Adds a glyph FreeType just rendered, to be written out the next time the
+// file is saved.  The bitmap is copied the way it's drawn, a row every width
+// bytes.  Running out of memory, or room, only means the glyph isn't kept,
+// and NULL is returned.
+
+static const GlyphFileEntry* add_glyph_file_entry(ParlayContext* ctx, FTC_FaceID face_id, int font_px,
+        FT_UInt glyph_index, const MetricsRecord* rec, const unsigned char* bitmap) {
+    GlyphFile* file = ctx->glyph_file;
+    GlyphFileEntry* entry;
+    GlyphFileRecord frec;
+    size_t n_bytes;
+
+    if (!get_glyph_file_key(ctx,face_id,&frec.face_key)) {
+        return NULL;
+    }
+    frec.glyph_index = glyph_index;
+    frec.font_px = font_px;
+    frec.is_sbit = rec->is_sbit;
+    frec.xadvance = rec->xadvance;
+    frec.left = rec->left;
+    frec.top = rec->top;
+    frec.width = rec->width;
+    frec.height = rec->height;
+    n_bytes = glyph_file_bitmap_bytes(&frec);
+    if (file->n_new_bytes + n_bytes > GLYPH_FILE_MAX_NEW_BYTES || (bitmap == NULL && n_bytes != 0)) {
+        return NULL;
+    }
+    entry = (GlyphFileEntry*)malloc(sizeof(GlyphFileEntry) + n_bytes);
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->rec = frec;
+    entry->bitmap = (const unsigned char*)&entry[1];
+    if (n_bytes != 0) {
+        memcpy((unsigned char*)&entry[1],bitmap,(size_t)frec.width*frec.height);
+        memset((unsigned char*)&entry[1] + (size_t)frec.width*frec.height,0,n_bytes - (size_t)frec.width*frec.height);
+    }
+    entry->saved = 0;
+    entry->allocated = 1;
+    insert_glyph_file_entry(file,entry);
+    file->n_new_bytes += n_bytes;
+    return entry;
+}
+
+
+// Reads the glyphs in a glyph file, which are used where they are in the
+// mapping.  A file that's missing, from another version, or damaged (say by
+// two programs saving to it at once) is left alone, and written over the
+// next time it's saved.  Returns nonzero only if memory runs out.
+
+static int read_glyph_file(FT_Library library, GlyphFile* file) {
+    GlyphFileHeader header;
+    GlyphFileRecord rec;
+    size_t offset, n_entries, n_bytes, k;
+    FT_Int major, minor, patch;
+
+    file->rewrite = 1;
+    if (map_file(file->filename,&file->data,&file->size)) {
+        file->data = NULL;
+        return 0;
+    }
+    FT_Library_Version(library,&major,&minor,&patch);
+    if (file->size < sizeof(GlyphFileHeader)) {
+        goto bad_file;
+    }
+    memcpy(&header,file->data,sizeof(GlyphFileHeader));
+    if (memcmp(header.magic,"PARLAYGF",8) || header.version != GLYPH_FILE_VERSION
+            || header.freetype_version != (uint32_t)(major << 16 | minor << 8 | patch) || header.byte_order != 0x01020304) {
+        goto bad_file;
+    }
+
+    n_entries = 0;
+    for (offset = sizeof(GlyphFileHeader); offset < file->size; offset += sizeof(GlyphFileRecord) + n_bytes) {
+        if (file->size - offset < sizeof(GlyphFileRecord)) {
+            goto bad_file;
+        }
+        memcpy(&rec,file->data + offset,sizeof(GlyphFileRecord));
+        if (rec.width < 0 || rec.height < 0 || (rec.height != 0 && (size_t)rec.width > (file->size - offset) / rec.height)) {
+            goto bad_file;
+        }
+        n_bytes = glyph_file_bitmap_bytes(&rec);
+        if (file->size - offset - sizeof(GlyphFileRecord) < n_bytes) {
+            goto bad_file;
+        }
+        n_entries++;
+    }
+
+    if (n_entries != 0) {
+        file->file_entries = (GlyphFileEntry*)malloc(n_entries*sizeof(GlyphFileEntry));
+        if (file->file_entries == NULL) {
+            return 1;
+        }
+    }
+    k = 0;
+    for (offset = sizeof(GlyphFileHeader); offset < file->size; offset += sizeof(GlyphFileRecord) + n_bytes) {
+        memcpy(&file->file_entries[k].rec,file->data + offset,sizeof(GlyphFileRecord));
+        file->file_entries[k].bitmap = file->data + offset + sizeof(GlyphFileRecord);
+        file->file_entries[k].saved = 1;
+        file->file_entries[k].allocated = 0;
+        insert_glyph_file_entry(file,&file->file_entries[k]);
+        n_bytes = glyph_file_bitmap_bytes(&file->file_entries[k].rec);
+        k++;
+    }
+    file->rewrite = 0;
+    return 0;
+
+bad_file:
+    unmap_file(file->data,file->size);
+    file->data = NULL;
+    return 0;
+}
+
+
+static void delete_glyph_file(GlyphFile* file) {
+    GlyphFileEntry* entry;
+    GlyphFileEntry* next;
+    size_t k;
+    if (file->buckets != NULL) {
+        for (k = 0; k < GLYPH_FILE_BUCKETS; k++) {
+            for (entry = file->buckets[k]; entry != NULL; entry = next) {
+                next = entry->next;
+                if (entry->allocated) {
+                    free(entry);
+                }
+            }
+        }
+        free(file->buckets);
+    }
+    if (file->file_entries != NULL) {
+        free(file->file_entries);
+    }
+    if (file->data != NULL) {
+        unmap_file(file->data,file->size);
+    }
+    free(file);
+}
+
+
+// Gets the advance and bitmap box a glyph renders with from the glyph file,
+// or else from FreeType's caches, rendering it into them if it isn't there.
+// If rbitmap isn't NULL the bitmap is stored there, and rpinned says whether
+// it's in the glyph file, where it stays as long as the context, rather than
+// in FreeType's caches.
+
+static int get_rendered_glyph_record(ParlayContext* ctx, FTC_Scaler scaler, FT_UInt glyph_index, MetricsRecord* rec,
+        const unsigned char** rbitmap, int* rpinned) {
+    FTC_SBit sbit;
+    FT_BitmapGlyph glyph;
+    const GlyphFileEntry* entry;
+    const unsigned char* bitmap;
+
+    if (ctx->glyph_file != NULL) {
+        entry = find_glyph_file_entry(ctx,scaler->face_id,scaler->width,glyph_index);
+        if (entry != NULL) {
+            rec->is_sbit = entry->rec.is_sbit;
+            rec->xadvance = entry->rec.xadvance;
+            rec->width = entry->rec.width;
+            rec->height = entry->rec.height;
+            rec->left = entry->rec.left;
+            rec->top = entry->rec.top;
+            if (rbitmap != NULL) {
+                *rbitmap = entry->bitmap;
+                *rpinned = 1;
+            }
+            return 0;
+        }
+    }
+    if (FTC_SBitCache_LookupScaler(ctx->sbit_cache,scaler,FT_LOAD_RENDER,glyph_index,&sbit,NULL)) {
+        return 1;
+    }
+    // FreeType marks a glyph too big for the small bitmap cache with a
+    // width of 255 and no buffer, leaving the other fields unreliable
+    if (sbit->width != 255 || sbit->buffer != NULL) {
+        rec->is_sbit = 1;
+        rec->xadvance = sbit->xadvance;
+        rec->width = sbit->width;
+        rec->height = sbit->height;
+        rec->left = sbit->left;
+        rec->top = sbit->top;
+        bitmap = sbit->buffer;
+    } else {
+        if (FTC_ImageCache_LookupScaler(ctx->image_cache,scaler,FT_LOAD_RENDER,glyph_index,(FT_Glyph*)&glyph,NULL)) {
+            return 2;
+        }
+        rec->is_sbit = 0;
+        rec->xadvance = glyph->root.advance.x >> 16;
+        rec->width = glyph->bitmap.width;
+        rec->height = glyph->bitmap.rows;
+        rec->left = glyph->left;
+        rec->top = glyph->top;
+        bitmap = glyph->bitmap.buffer;
+    }
+    if (rbitmap != NULL) {
+        *rbitmap = bitmap;
+        *rpinned = 0;
+    }
+    if (ctx->glyph_file != NULL) {
+        entry = add_glyph_file_entry(ctx,scaler->face_id,scaler->width,glyph_index,rec,bitmap);
+        if (entry != NULL && rbitmap != NULL) {
+            *rbitmap = entry->bitmap;
+            *rpinned = 1;
+        }
+    }
+    return 0;
+}
+
+
+// Renders a glyph and adds it to the glyph cache, which must have room for
+// it.  Returns 3 if there's no memory for its bitmap.
+
+static int add_rendered_glyph_to_cache(ParlayContext* ctx, FTC_Scaler scaler, FT_UInt glyph_index,
+        const GlyphCacheEntry** rglyph) {
+    GlyphCacheEntry glyph;
+    MetricsRecord rec;
+    const unsigned char* bitmap;
+    size_t n_bytes;
+    int pinned;
+    int status;
+
+    status = get_rendered_glyph_record(ctx,scaler,glyph_index,&rec,&bitmap,&pinned);
+    if (status) {
+        return status;
+    }
+    glyph.face_id = scaler->face_id;
+    glyph.font_px = scaler->width;
+    glyph.key = glyph_index;
+    glyph.by_glyph_index = 1;
+    glyph.glyph_face_id = scaler->face_id;
+    glyph.glyph_index = glyph_index;
+    glyph.is_sbit = rec.is_sbit;
+    glyph.xadvance = rec.xadvance;
+    glyph.left = rec.left;
+    glyph.top = rec.top;
+    glyph.width = rec.width;
+    glyph.height = rec.height;
+    glyph.bitmap = bitmap;
+    n_bytes = (size_t)rec.width * rec.height;
+    if (!pinned) {
+        glyph.bitmap = NULL;
+        if (n_bytes != 0) {
+            glyph.bitmap = copy_glyph_bitmap(&ctx->glyph_cache,bitmap,n_bytes);
+            if (glyph.bitmap == NULL) {
+                return 3;
+            }
+        }
+    }
+    *rglyph = add_glyph_cache_entry(&ctx->glyph_cache,&glyph);
+    return 0;
+}
+
+
+// Gets a glyph from the glyph cache, rendering it if it isn't there
+
+static int get_cached_glyph(ParlayContext* ctx, FTC_Scaler scaler, FT_UInt glyph_index,
+        const GlyphCacheEntry** rglyph) {
+    const GlyphCacheEntry* glyph;
+
+    glyph = find_glyph_cache_entry(&ctx->glyph_cache,scaler->face_id,scaler->width,glyph_index,1);
+    if (glyph != NULL) {
+        *rglyph = glyph;
+        return 0;
+    }
+    if (make_room_in_glyph_cache(&ctx->glyph_cache,1)) {
+        return 3;
+    }
+    return add_rendered_glyph_to_cache(ctx,scaler,glyph_index,rglyph);
+}
+
+
+// Gets the glyph a character in a font comes to from the glyph cache.  The
+// first time, the character is looked up the way find_character_glyph does,
+// and the glyph is added under its glyph index too, so mirrored characters
+// that come to it share it.
+
+static int get_cached_character(ParlayContext* ctx, const FontRecord* font_rec, int font_style, FTC_Scaler scaler,
+        codepoint_t c, const GlyphCacheEntry** rglyph) {
+    GlyphCache* cache = &ctx->glyph_cache;
+    GlyphCacheEntry entry;
+    const GlyphCacheEntry* glyph;
+    FTC_ScalerRec glyph_scaler;
+    FT_UInt glyph_index;
+    int status;
+
+    glyph = find_glyph_cache_entry(cache,scaler->face_id,scaler->width,c,0);
+    if (glyph != NULL) {
+        *rglyph = glyph;
+        return 0;
+    }
+    if (make_room_in_glyph_cache(cache,2)) {
+        return 3;
+    }
+    glyph_scaler = *scaler;
+    glyph_index = find_character_glyph(ctx,font_rec,font_style,scaler->face_id,c,&glyph_scaler.face_id);
+    glyph = find_glyph_cache_entry(cache,glyph_scaler.face_id,glyph_scaler.width,glyph_index,1);
+    if (glyph == NULL) {
+        status = add_rendered_glyph_to_cache(ctx,&glyph_scaler,glyph_index,&glyph);
+        if (status) {
+            return status;
+        }
+    }
+    entry = *glyph;
+    entry.face_id = scaler->face_id;
+    entry.key = c;
+    entry.by_glyph_index = 0;
+    *rglyph = add_glyph_cache_entry(cache,&entry);
+    return 0;
+}
+
+
+static void get_cached_glyph_record(const GlyphCacheEntry* glyph, MetricsRecord* rec) {
+    rec->is_sbit = glyph->is_sbit;
+    rec->xadvance = glyph->xadvance;
+    rec->width = glyph->width;
+    rec->height = glyph->height;
+    rec->left = glyph->left;
+    rec->top = glyph->top;
+}
+
+
+// Gets the advance and bitmap box a glyph will render with, from the glyph
+// cache, or from the metrics cache if the layout is only being measured, in
+// which case rglyph is set to NULL
+
+static int get_glyph_record(ParlayContext* ctx, const ParlayLayout* layout, FTC_Scaler scaler, FT_UInt glyph_index,
+        MetricsRecord* rec, const GlyphCacheEntry** rglyph) {
+
+    MetricsRecord* metrics;
+    const GlyphFileEntry* entry;
+    const GlyphCacheEntry* glyph;
+    int status;
+
+    if (layout->metrics_only) {
+        *rglyph = NULL;
+        entry = find_glyph_file_entry(ctx,scaler->face_id,scaler->width,glyph_index);
+        if (entry != NULL) {
+            rec->is_sbit = entry->rec.is_sbit;
+            rec->xadvance = entry->rec.xadvance;
+            rec->width = entry->rec.width;
+            rec->height = entry->rec.height;
+            rec->left = entry->rec.left;
+            rec->top = entry->rec.top;
+            return 0;
+        }
+        if (get_glyph_metrics(ctx,scaler,glyph_index,&metrics)) {
+            return 1;
+        }
+        *rec = *metrics;
+        return 0;
+    }
+    status = get_cached_glyph(ctx,scaler,glyph_index,&glyph);
+    if (status) {
+        return status;
+    }
+    get_cached_glyph_record(glyph,rec);
+    *rglyph = glyph;
+    return 0;
+}
+
+
+// Adds a glyph at the pen position, with the advance and bitmap box it will
+// render with.  Moving the pen and wrapping the line are up to the caller.
+// The caller can pass the glyph's cache entry if it already has it, or NULL.
+
+static int add_glyph_to_layout(ParlayContext* ctx, ParlayLayout* layout, const ParlayStyle* style, FTC_Scaler scaler,
+        FT_UInt glyph_index, const GlyphCacheEntry* glyph, codepoint_t c, int line_height, int ascender,
+        ParlayGlyphPlan** rgp) {
+
+    MetricsRecord rec;
+    ParlayGlyphPlan* gp;
+    int status = 9999;
+
+    if (glyph != NULL) {
+        get_cached_glyph_record(glyph,&rec);
+    } else {
+        status = get_glyph_record(ctx,layout,scaler,glyph_index,&rec,&glyph);
+        if (status) {
+            status = status == 2 ? 1208 : status == 3 ? 1215 : 1207;
+            goto error;
+        }
+    }
+    if (layout->n_glyphs >= layout->n_glyphs_cap) {
+        status = increase_layout_glyph_capacity(layout);
+        if (status) {
+            status = 1209;
+            goto error;
+        }
+    }
+    gp = &layout->glyph_plans[layout->n_glyphs];
+    gp->is_sbit = rec.is_sbit;
+    gp->line_height = line_height;
+    gp->x = layout->glyph_x;
+    gp->y = 0;
+    gp->ascender = ascender;
+    gp->advance = rec.xadvance;
+    gp->highlight = style->highlight;
+    if (gp->highlight) {
+        layout->any_highlights = 1;
+        memcpy(gp->highlight_color,style->highlight_color,4*sizeof(float));
+    }
+    gp->underline = style->underline;
+    gp->hidden = 0;
+    gp->codepoint = c;
+    gp->mirrored = 0;
+    gp->break_before = layout->n_glyphs == layout->first_glyph_of_current_word;
+    gp->starts_paragraph = layout->n_glyphs == layout->first_glyph_of_current_paragraph;
+    gp->paragraph_level = -1;
+    if (rec.height != 0) {
+        gp->face_id = scaler->face_id;
+        gp->font_px = scaler->width;
+        gp->glyph_index = glyph_index;
+        gp->left = rec.left;
+        gp->width = rec.width;
+        gp->top = rec.top;
+        gp->height = rec.height;
+        gp->bitmap = glyph != NULL ? glyph->bitmap : NULL;
+        if (gp->bitmap != NULL && hold_glyph_bitmaps(ctx,layout)) {
+            status = 1215;
+            goto error;
+        }
+        memcpy(gp->text_color,style->text_color,4*sizeof(float));
+        gp->border_thickness = style->border_thickness;
+        if (style->border_thickness) {
+            memcpy(gp->border_color,style->border_color,4*sizeof(float));
+            // Anything but the other two methods smears, so the rest of the
+            // code only ever sees the three
+            gp->border_method = style->border_method == PARLAY_BORDER_DILATE
+                    || style->border_method == PARLAY_BORDER_STROKE ? style->border_method : PARLAY_BORDER_SMEAR;
+            layout->any_borders = 1;
+        }
+    } else {
+        gp->face_id = NULL;
+        gp->glyph_index = 0;
+        gp->bitmap = NULL;
+        // The rest shouldn't be needed, here as failsafe
+        gp->left = 0;
+        gp->width = 0;
+        gp->top = 0;
+        gp->height = 0;
+        gp->border_thickness = 0;
+    }
+    layout->n_glyphs++;
+    *rgp = gp;
+
+    status = 0;
+
+error:
+    return status;
+}
+
+
+// Says whether the line can be broken before a character of the given line
+// breaking class, and remembers the class for the next character.  This is
+// the pair table method from UAX #14: spaces never allow a break before
+// themselves, so only the last class before them is kept, along with the
+// fact that there were spaces.  Combining marks go with the character before
+// them, and are treated as letters when there isn't one.  Line breaks are
+// counted as spaces here; the line is ended by the caller.
+
+static int is_break_opportunity(ParlayLayout* layout, int lb_class) {
+    int prev_class = layout->prev_line_break_class;
+    int after_spaces = layout->line_break_after_spaces;
+    int action;
+
+    if (lb_class >= LB_SP) {
+        layout->line_break_after_spaces = 1;
+        return 0;
+    }
+    if (lb_class == LB_CM) {
+        if (!after_spaces) {
+            return 0;
+        }
+        lb_class = LB_AL;
+    }
+    action = line_break_pairs[prev_class][lb_class];
+    layout->prev_line_break_class = lb_class;
+    layout->line_break_after_spaces = 0;
+    return action == LB_DIRECT || (action == LB_INDIRECT && after_spaces);
+}
+
+
+static int add_text_to_layout(ParlayContext* ctx, ParlayLayout* layout, const char** text_handle,
+        const ParlayStyle* style, int wrap_width, int collapse_whitespace, size_t max_characters) {
+
+    const FontRecord* font_rec;
+    FTC_FaceID face_id;
+    FTC_FaceID glyph_face_id;
+    FT_Face face;
+    FTC_ScalerRec face_size_info;
+    FTC_ScalerRec fallback_size_info;
+    FTC_Scaler glyph_scaler;
+    const GlyphCacheEntry* glyph;
+    FT_Size size;
+    FaceMemo* memo = &ctx->face_memo;
+    int font_px, line_height, ascender, has_kerning, kerning;
+    int prev_was_whitespace, lb_class, can_break;
+    const unsigned char* text;
+    const unsigned char* text_end;
+    codepoint_t block[DECODE_BLOCK_SIZE];
+    size_t n_block, i_block, error_offset;
+    codepoint_t c;
+    FT_UInt glyph_index;
+    ParlayGlyphPlan* gp;
+    int status = 9999;
+    size_t ichr;
+
+    font_px = (int)ceil(style->font_size * style->font_scaler);
+
+    // Text tends to come in long runs of the same font and size, so the last
+    // face and size looked up are remembered and the lookups skipped on a hit.
+
+    if (memo->font_rec != NULL && memo->font_style == style->font_style && memo->font_px == font_px
+            && (style->font_name == NULL ? memo->font_rec->handle == style->font_handle
+                : !strcmp(memo->font_rec->name,style->font_name))) {
+        face_id = memo->face_id;
+        line_height = memo->line_height;
+        ascender = memo->ascender;
+        has_kerning = memo->has_kerning;
+    } else {
+        if (style->font_name == NULL) {
+            font_rec = lookup_font_handle(ctx,style->font_handle);
+        } else {
+            font_rec = lookup_font_record(ctx,style->font_name);
+        }
+        face_id = font_rec != NULL ? get_style_face_id(font_rec,style->font_style) : NULL;
+        if (face_id == NULL) {
+            status = 1201;
+            goto error;
+        }
+
+        status = FTC_Manager_LookupFace(ctx->manager,face_id,&face);
+        if (status) {
+            status = 1202;
+            goto error;
+        }
+
+        face_size_info.face_id = face_id;
+        face_size_info.width = font_px;
+        face_size_info.height = font_px;
+        face_size_info.pixel = 1;
+        face_size_info.x_res = 0;
+        face_size_info.y_res = 0;
+
+        status = FTC_Manager_LookupSize(ctx->manager,&face_size_info,&size);
+        if (status) {
+            status = 1203;
+            goto error;
+        }
+
+        line_height = (int)((float)face->height * size->metrics.x_ppem / face->units_per_EM + 0.5);
+        ascender = (int)((float)face->ascender * size->metrics.x_ppem / face->units_per_EM + 0.5);
+        has_kerning = FT_HAS_KERNING(face) ? 1 : 0;
+
+        memo->font_rec = font_rec;
+        memo->font_style = style->font_style;
+        memo->font_px = font_px;
+        memo->face_id = face_id;
+        memo->line_height = line_height;
+        memo->ascender = ascender;
+        memo->has_kerning = has_kerning;
+    }
+    font_rec = memo->font_rec;
+
+    face_size_info.face_id = face_id;
+    face_size_info.width = font_px;
+    face_size_info.height = font_px;
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+
+    text = (const unsigned char*)*text_handle;
+    text_end = text + strlen(*text_handle);
+    // What was wrong, and where in this piece of the text, is kept for
+    // parlay_context_last_utf8_error
+    error_offset = 0;
+    ctx->utf8_error = ctx->check_utf8(text,(size_t)(text_end-text),&error_offset);
+    ctx->utf8_error_offset = error_offset;
+    if (ctx->utf8_error) {
+        status = 1205;
+        goto error;
+    }
+
+    prev_was_whitespace = 0;
+
+    n_block = 0;
+    i_block = 0;
+    for (ichr = 0; ichr < max_characters; ichr++) {
+        if (i_block == n_block) {
+            n_block = max_characters - ichr;
+            if (n_block > DECODE_BLOCK_SIZE) {
+                n_block = DECODE_BLOCK_SIZE;
+            }
+            n_block = decode_utf8(&text,text_end,block,n_block,ctx->ascii_span);
+            if (n_block == 0) {
+                break;
+            }
+            i_block = 0;
+        }
+        c = block[i_block++];
+        if (is_rtl_character(c)) {
+            layout->any_rtl = 1;
+        }
+        // Only wrapped text needs to know where its lines can break.  Text
+        // without spaces, such as Chinese or Japanese, can still break
+        // between most characters, and other text after hyphens and slashes.
+        can_break = 0;
+        if (wrap_width > 0) {
+            if (collapse_whitespace && is_collapsable_whitespace(c)) {
+                lb_class = LB_SP;
+            } else {
+                lb_class = get_line_break_class(c);
+            }
+            can_break = is_break_opportunity(layout,lb_class);
+        }
+        if (can_break) {
+            layout->first_glyph_of_current_word = layout->n_glyphs;
+        }
+        if (collapse_whitespace) {
+            if (is_collapsable_whitespace(c)) {
+                if (prev_was_whitespace || layout->glyph_x == 0) {
+                    continue;
+                }
+                c = ' ';
+                prev_was_whitespace = 1;
+            } else {
+                prev_was_whitespace = 0;
+            }
+        } else if (is_line_break(c)) {
+            if (wrap_width > 0 && layout->line_breaking == PARLAY_BREAK_OPTIMAL) {
+                if (break_lines_optimally(layout,wrap_width)) {
+                    status = 1214;
+                    goto error;
+                }
+            }
+            lay_out_line(layout,line_height,ascender);
+            layout->prev_glyph_index = 0;
+            layout->prev_line_break_class = LB_WJ;
+            layout->line_break_after_spaces = 0;
+            // A new line is a new paragraph, with a direction of its own,
+            // except after a line separator
+            if (get_bidi_class(c) == BIDI_B) {
+                layout->first_glyph_of_current_paragraph = layout->n_glyphs;
+            }
+            continue;
+        }
+        if (is_bidi_control(c)) {
+            // Bidi controls are laid out as a space with no width, so they
+            // still steer the bidi pass but draw nothing
+            glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,face_id,0,' ');
+            status = add_glyph_to_layout(ctx,layout,style,&face_size_info,glyph_index,NULL,c,line_height,ascender,
+                    &gp);
+            if (status) {
+                goto error;
+            }
+            gp->advance = 0;
+            continue;
+        }
+        // Characters the font doesn't have come from its fallbacks, and
+        // only the font's own glyphs are kerned.  Text that will be drawn
+        // gets the glyph a character comes to from the glyph cache, so a
+        // character seen before costs FreeType nothing.
+        glyph = NULL;
+        if (!layout->metrics_only) {
+            status = get_cached_character(ctx,font_rec,style->font_style,&face_size_info,c,&glyph);
+            if (status) {
+                status = status == 2 ? 1208 : status == 3 ? 1215 : 1207;
+                goto error;
+            }
+            glyph_index = glyph->glyph_index;
+            glyph_face_id = glyph->glyph_face_id;
+        } else {
+            glyph_index = find_character_glyph(ctx,font_rec,style->font_style,face_id,c,&glyph_face_id);
+        }
+        glyph_scaler = &face_size_info;
+        if (glyph_face_id != face_id) {
+            fallback_size_info = face_size_info;
+            fallback_size_info.face_id = glyph_face_id;
+            glyph_scaler = &fallback_size_info;
+        }
+        // Kerning only applies between glyphs of the same face and size, but
+        // carries across calls, so it isn't lost where only the color changes
+        if (layout->kerning && has_kerning && layout->prev_glyph_index != 0 && glyph_scaler->face_id == face_id
+                && layout->prev_face_id == face_id && layout->prev_font_px == font_px) {
+            status = get_kerning(ctx,&face_size_info,layout->prev_glyph_index,glyph_index,&kerning);
+            if (status) {
+                status = 1211;
+                goto error;
+            }
+            layout->glyph_x += kerning;
+        }
+        status = add_glyph_to_layout(ctx,layout,style,glyph_scaler,glyph_index,glyph,c,line_height,ascender,&gp);
+        if (status) {
+            goto error;
+        }
+        layout->glyph_x += gp->advance;
+        if (wrap_width > 0 && layout->line_breaking == PARLAY_BREAK_GREEDY && !is_word_break(c)
+                && gp->x + gp->left + gp->width + gp->border_thickness > wrap_width) {
+            lay_out_most_of_line(layout);
+        }
+        layout->prev_face_id = glyph_scaler->face_id;
+        layout->prev_font_px = font_px;
+        layout->prev_glyph_index = glyph_index;
+    }
+    *text_handle = (const char*)text;
+    status = 0;
+
+error:
+    return status;
+}
+
+
+// Bidirectional text is laid out in text order, as if it were all
+// left-to-right, and put in display order a line at a time once the lines are
+// known.  This follows the Unicode Bidirectional Algorithm (UAX #9).  Each
+// hard line break (other than a line separator) starts a new paragraph, whose
+// direction is set by its first strong character.  Explicit embeddings,
+// overrides, and isolates are ignored, so each paragraph is a single run at
+// its own level.  A layout with no right-to-left characters in it never gets
+// this far.
+
+static __inline int is_strong_or_number(int t) {
+    return t == BIDI_L || t == BIDI_R || t == BIDI_EN || t == BIDI_AN;
+}
+
+
+static const BracketPair* get_bracket(codepoint_t c) {
+    size_t lo = 0, hi = sizeof(bidi_brackets)/sizeof(bidi_brackets[0]), mid;
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (c < bidi_brackets[mid].c) {
+            hi = mid;
+        } else if (c > bidi_brackets[mid].c) {
+            lo = mid + 1;
+        } else {
+            return &bidi_brackets[mid];
+        }
+    }
+    return NULL;
+}
+
+
+// The angle brackets at U+2329 and U+232A are canonically the same as the
+// ones at U+3008 and U+3009, so either closes the other
+
+static __inline codepoint_t canonical_bracket(codepoint_t c) {
+    return c == 0x2329 ? 0x3008 : c == 0x232A ? 0x3009 : c;
+}
+
+
+// The direction a type counts as for brackets and neutrals, with numbers
+// counting as right-to-left, or -1 for a neutral
+
+static __inline int strong_direction(int t) {
+    return t == BIDI_L ? BIDI_L : is_strong_or_number(t) ? BIDI_R : -1;
+}
+
+
+// Sets a bracket resolved by rule N0 to a direction, along with any marks
+// after it, which W1 gave the bracket's type
+
+static void set_bracket_type(unsigned char* types, const codepoint_t* chars, size_t n, size_t i, int t) {
+    types[i] = (unsigned char)t;
+    for (i++; i < n && get_bidi_class(chars[i]) == BIDI_NSM; i++) {
+        types[i] = (unsigned char)t;
+    }
+}
+
+
+// Rules BD16 and N0: pairs up brackets, and gives each pair the direction
+// of the strong text inside it.  If that's the paragraph's direction, or
+// there's text going both ways, they go the paragraph's way; if it's only
+// the other way, they go that way too if the strong text before the opening
+// bracket does, and otherwise the paragraph's.  Pairs with no strong text
+// inside are left to N1 and N2.  pairs gets the closing bracket of each
+// opening one.  Once brackets nest too deeply, none of the rest of the
+// paragraph's are paired.
+
+static void resolve_bracket_pairs(unsigned char* types, const codepoint_t* chars, size_t* pairs, size_t n,
+        int sos) {
+    codepoint_t stack_close[BRACKET_STACK_DEPTH];
+    size_t stack_pos[BRACKET_STACK_DEPTH];
+    const BracketPair* bracket;
+    size_t i, j, depth = 0;
+    int dir, inside, before;
+
+    for (i = 0; i < n; i++) {
+        pairs[i] = SIZE_MAX;
+    }
+    for (i = 0; i < n; i++) {
+        if (types[i] != BIDI_ON || (bracket = get_bracket(chars[i])) == NULL) {
+            continue;
+        }
+        if (bracket->type == BRACKET_OPEN) {
+            if (depth == BRACKET_STACK_DEPTH) {
+                break;
+            }
+            stack_close[depth] = canonical_bracket(bracket->pair);
+            stack_pos[depth] = i;
+            depth++;
+        } else {
+            for (j = depth; j-- > 0; ) {
+                if (stack_close[j] == canonical_bracket(chars[i])) {
+                    pairs[stack_pos[j]] = i;
+                    depth = j;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Pairs are resolved in the order they open, and a resolved bracket
+    // counts as strong text for the ones after it
+    before = sos;
+    for (i = 0; i < n; i++) {
+        if (pairs[i] != SIZE_MAX) {
+            inside = -1;
+            for (j = i+1; j < pairs[i]; j++) {
+                dir = strong_direction(types[j]);
+                if (dir == sos) {
+                    inside = sos;
+                    break;
+                } else if (dir != -1) {
+                    inside = dir;
+                }
+            }
+            if (inside != -1) {
+                dir = inside == sos ? sos : before;
+                set_bracket_type(types,chars,n,i,dir);
+                set_bracket_type(types,chars,n,pairs[i],dir);
+            }
+        }
+        if ((dir = strong_direction(types[i])) != -1) {
+            before = dir;
+        }
+    }
+}
+
+
+// Resolves the embedding level of each of n characters of a paragraph from
+// their types (rules W1 through I2).  The types are overwritten, and pairs is
+// scratch space for n entries.
+
+static void resolve_bidi_levels(unsigned char* types, unsigned char* levels, const codepoint_t* chars, size_t* pairs,
+        size_t n, int base_level) {
+    int sos = (base_level & 1) ? BIDI_R : BIDI_L;
+    int last_strong, lead, trail;
+    size_t i, j;
+
+    // W1, with boundary neutrals taking the type before them as well
+    for (i = 0; i < n; i++) {
+        if (types[i] == BIDI_NSM || types[i] == BIDI_BN) {
+            types[i] = i > 0 ? types[i-1] : sos;
+        }
+    }
+
+    // W2 and W3
+    last_strong = sos;
+    for (i = 0; i < n; i++) {
+        if (types[i] == BIDI_L || types[i] == BIDI_R || types[i] == BIDI_AL) {
+            last_strong = types[i];
+        } else if (types[i] == BIDI_EN && last_strong == BIDI_AL) {
+            types[i] = BIDI_AN;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        if (types[i] == BIDI_AL) {
+            types[i] = BIDI_R;
+        }
+    }
+
+    // W4: a single separator between two numbers of the same kind
+    for (i = 1; i+1 < n; i++) {
+        if (types[i] == BIDI_ES && types[i-1] == BIDI_EN && types[i+1] == BIDI_EN) {
+            types[i] = BIDI_EN;
+        } else if (types[i] == BIDI_CS && types[i-1] == types[i+1]
+                && (types[i-1] == BIDI_EN || types[i-1] == BIDI_AN)) {
+            types[i] = types[i-1];
+        }
+    }
+
+    // W5: terminators next to European numbers
+    for (i = 0; i < n; i = j) {
+        j = i + 1;
+        if (types[i] == BIDI_ET) {
+            while (j < n && types[j] == BIDI_ET) {
+                j++;
+            }
+            if ((i > 0 && types[i-1] == BIDI_EN) || (j < n && types[j] == BIDI_EN)) {
+                memset(&types[i],BIDI_EN,j-i);
+            }
+        }
+    }
+
+    // W6 and W7
+    last_strong = sos;
+    for (i = 0; i < n; i++) {
+        if (types[i] == BIDI_ES || types[i] == BIDI_ET || types[i] == BIDI_CS) {
+            types[i] = BIDI_ON;
+        } else if (types[i] == BIDI_L || types[i] == BIDI_R) {
+            last_strong = types[i];
+        } else if (types[i] == BIDI_EN && last_strong == BIDI_L) {
+            types[i] = BIDI_L;
+        }
+    }
+
+    resolve_bracket_pairs(types,chars,pairs,n,sos);
+
+    // N1 and N2: neutrals take the direction around them if both sides
+    // agree, numbers counting as right-to-left, or else the paragraph's
+    for (i = 0; i < n; i = j) {
+        j = i + 1;
+        if (!is_strong_or_number(types[i])) {
+            while (j < n && !is_strong_or_number(types[j])) {
+                j++;
+            }
+            lead = i > 0 ? (types[i-1] == BIDI_L ? BIDI_L : BIDI_R) : sos;
+            trail = j < n ? (types[j] == BIDI_L ? BIDI_L : BIDI_R) : sos;
+            memset(&types[i],lead == trail ? lead : sos,j-i);
+        }
+    }
+
+    // I1 and I2
+    for (i = 0; i < n; i++) {
+        levels[i] = (unsigned char)base_level;
+        if (base_level & 1) {
+            if (types[i] != BIDI_R) {
+                levels[i]++;
+            }
+        } else if (types[i] == BIDI_R) {
+            levels[i]++;
+        } else if (types[i] == BIDI_EN || types[i] == BIDI_AN) {
+            levels[i] += 2;
+        }
+    }
+}
+
+
+// Swaps a glyph for its mirror image, or back again.  A font that doesn't
+// have the mirror image keeps the glyph as it is.
+
+static int mirror_glyph(ParlayContext* ctx, ParlayLayout* layout, ParlayGlyphPlan* gp, int mirrored) {
+    FTC_ScalerRec face_size_info;
+    MetricsRecord rec;
+    const GlyphCacheEntry* glyph;
+    FT_UInt glyph_index;
+    codepoint_t c;
+
+    c = mirrored ? get_mirror_character(gp->codepoint) : gp->codepoint;
+    glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,gp->face_id,0,c);
+    if (glyph_index == 0) {
+        return 0;
+    }
+    face_size_info.face_id = gp->face_id;
+    face_size_info.width = gp->font_px;
+    face_size_info.height = gp->font_px;
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+    if (get_glyph_record(ctx,layout,&face_size_info,glyph_index,&rec,&glyph)) {
+        return 1;
+    }
+    if (rec.height == 0) {
+        return 0;
+    }
+    gp->glyph_index = glyph_index;
+    gp->bitmap = glyph != NULL ? glyph->bitmap : NULL;
+    if (gp->bitmap != NULL && hold_glyph_bitmaps(ctx,layout)) {
+        return 1;
+    }
+    gp->is_sbit = rec.is_sbit;
+    gp->advance = rec.xadvance;
+    gp->left = rec.left;
+    gp->top = rec.top;
+    gp->width = rec.width;
+    gp->height = rec.height;
+    gp->mirrored = mirrored;
+    return 0;
+}
+
+
+// P2 and P3: a paragraph goes the way of its first strong character.  This
+// finds the paragraph glyph k is in, and its level, which is kept in its first
+// glyph once it's known.  Until the paragraph has a strong character (in a
+// builder, it may not have one yet), it goes left to right.
+
+static int get_paragraph_level(ParlayLayout* layout, size_t k) {
+    ParlayGlyphPlan* glyph_plans = layout->glyph_plans;
+    size_t p;
+    int bidi_class;
+
+    if (k >= layout->first_glyph_of_current_paragraph) {
+        p = layout->first_glyph_of_current_paragraph;
+    } else {
+        for (p = k; p > 0 && !glyph_plans[p].starts_paragraph; p--) {
+        }
+    }
+    if (glyph_plans[p].paragraph_level < 0) {
+        for (k = p; k < layout->n_glyphs && (k == p || !glyph_plans[k].starts_paragraph); k++) {
+            bidi_class = get_bidi_class(glyph_plans[k].codepoint);
+            if (bidi_class == BIDI_L) {
+                glyph_plans[p].paragraph_level = 0;
+                break;
+            } else if (bidi_class == BIDI_R || bidi_class == BIDI_AL) {
+                glyph_plans[p].paragraph_level = 1;
+                break;
+            }
+        }
+    }
+    return MAX(glyph_plans[p].paragraph_level,0);
+}
+
+
+// Puts the lines made of glyphs first to end-1 in display order, by moving
+// glyphs, not by changing their order in the layout.  Each glyph keeps the
+// space it had from its own pen position to the next glyph's, so kerning
+// inside a run survives.  Like realign_lines, the range must start at the
+// start of a line.  Calling it again on glyphs put back in text order gives
+// the same result, since glyphs are mirrored or not from scratch each time.
+
+static int reorder_lines(ParlayContext* ctx, ParlayLayout* layout, size_t first, size_t end) {
+    ParlayGlyphPlan* glyph_plans = layout->glyph_plans;
+    unsigned char* work = NULL;
+    unsigned char* types;
+    unsigned char* levels;
+    codepoint_t* chars;
+    size_t* order;
+    size_t* pairs;
+    int* widths;
+    size_t n = end - first, i, j, k, line_first, line_end, para_first, para_end, t;
+    int base_level, max_level, min_odd_level, trailing, pen, old_advance, bidi_class;
+    int status = 9999;
+
+    if (!layout->any_rtl || n == 0) {
+        return 0;
+    }
+
+    work = (unsigned char*)malloc(n*(2*sizeof(size_t) + sizeof(codepoint_t) + sizeof(int) + 2));
+    if (work == NULL) {
+        status = 1501;
+        goto error;
+    }
+    order = (size_t*)work;
+    pairs = &order[n];
+    chars = (codepoint_t*)&pairs[n];
+    widths = (int*)&chars[n];
+    types = (unsigned char*)&widths[n];
+    levels = &types[n];
+
+    // P1: a paragraph ends at a hard line break, which always ends a line,
+    // so each line is all in one paragraph
+    for (k = 0; k < n; k++) {
+        chars[k] = glyph_plans[first+k].codepoint;
+        types[k] = (unsigned char)get_bidi_class(chars[k]);
+    }
+    for (para_first = 0; para_first < n; para_first = para_end) {
+        para_end = para_first + 1;
+        while (para_end < n && !glyph_plans[first+para_end].starts_paragraph) {
+            para_end++;
+        }
+        base_level = get_paragraph_level(layout,first+para_first);
+        resolve_bidi_levels(&types[para_first],&levels[para_first],&chars[para_first],&pairs[para_first],
+                para_end-para_first,base_level);
+    }
+
+    base_level = 0;
+    for (line_first = 0; line_first < n; line_first = line_end) {
+        line_end = line_first + 1;
+        while (line_end < n && glyph_plans[first+line_end].y == glyph_plans[first+line_first].y) {
+            line_end++;
+        }
+        if (line_first == 0 || glyph_plans[first+line_first].starts_paragraph) {
+            base_level = get_paragraph_level(layout,first+line_first);
+        }
+
+        // L1: separators, and whitespace before them or at the end of the
+        // line, go back to the paragraph level
+        trailing = 1;
+        for (k = line_end; k-- > line_first; ) {
+            bidi_class = get_bidi_class(glyph_plans[first+k].codepoint);
+            if (bidi_class == BIDI_S || bidi_class == BIDI_B) {
+                levels[k] = (unsigned char)base_level;
+                trailing = 1;
+            } else if (trailing && (bidi_class == BIDI_WS || bidi_class == BIDI_BN)) {
+                levels[k] = (unsigned char)base_level;
+            } else {
+                trailing = 0;
+            }
+        }
+
+        max_level = 0;
+        min_odd_level = INT_MAX;
+        for (k = line_first; k < line_end; k++) {
+            max_level = MAX(max_level,levels[k]);
+            if (levels[k] & 1) {
+                min_odd_level = MIN(min_odd_level,levels[k]);
+            }
+        }
+        for (k = line_first; k < line_end; k++) {
+            widths[k] = k+1 < line_end ? glyph_plans[first+k+1].x - glyph_plans[first+k].x : glyph_plans[first+k].advance;
+            order[k] = k;
+        }
+
+        // L4: characters on right-to-left levels are drawn mirrored
+        for (k = line_first; k < line_end; k++) {
+            ParlayGlyphPlan* gp = &glyph_plans[first+k];
+            if (gp->face_id != NULL && (levels[k] & 1) != gp->mirrored
+                    && get_mirror_character(gp->codepoint) != 0) {
+                old_advance = gp->advance;
+                if (mirror_glyph(ctx,layout,gp,levels[k] & 1)) {
+                    status = 1502;
+                    goto error;
+                }
+                widths[k] += gp->advance - old_advance;
+            }
+        }
+
+        // L2: reverse every run at or above each level, from the highest
+        // level down to the lowest odd one
+        for (; max_level >= min_odd_level; max_level--) {
+            for (i = line_first; i < line_end; i = j + 1) {
+                while (i < line_end && levels[order[i]] < max_level) {
+                    i++;
+                }
+                for (j = i; j < line_end && levels[order[j]] >= max_level; j++) {
+                }
+                for (k = 0; k < (j-i)/2; k++) {
+                    t = order[i+k];
+                    order[i+k] = order[j-1-k];
+                    order[j-1-k] = t;
+                }
+            }
+        }
+
+        // L3: combining marks that were laid out by character go back after
+        // their base, which is where their bitmaps expect to be drawn
+        for (i = line_first; i < line_end; i = j + 1) {
+            j = i;
+            while (j < line_end && (levels[order[j]] & 1)
+                    && get_bidi_class(glyph_plans[first+order[j]].codepoint) == BIDI_NSM) {
+                j++;
+            }
+            if (j > i && j < line_end) {
+                for (k = 0; k < (j-i+1)/2; k++) {
+                    t = order[i+k];
+                    order[i+k] = order[j-k];
+                    order[j-k] = t;
+                }
+            }
+        }
+
+        pen = glyph_plans[first+line_first].x;
+        for (k = line_first; k < line_end; k++) {
+            glyph_plans[first+order[k]].x = pen;
+            pen += widths[order[k]];
+        }
+    }
+
+    status = 0;
+
+error:
+    if (work != NULL) {
+        free(work);
+    }
+    return status;
+}
+
+
+static void get_x_glyph_bounds(ParlayLayout* layout, int* pleft, int* pright) {
+    int i, left, right;
+    if (layout->n_glyphs == 0) {
+        *pleft = *pright = 0;
+        return;
+    }
+    left = INT_MAX;
+    right = INT_MIN;
+    for (i = 0; i < layout->n_glyphs; i++) {
+        ParlayGlyphPlan* gp = &layout->glyph_plans[i];
+        if (gp->glyph_index != 0) {
+            left = MIN(left,gp->x+gp->left-gp->border_thickness);
+            right = MAX(right,gp->x+gp->left+gp->width+gp->border_thickness);
+        }
+    }
+    *pleft = left;
+    *pright = right;
+}
+
+
+static void get_y_glyph_bounds(ParlayLayout* layout, int* pbottom, int* ptop) {
+    int i, bottom, top;
+    if (layout->n_glyphs == 0) {
+        *pbottom = *ptop = 0;
+        return;
+    }
+    bottom = INT_MAX;
+    top = INT_MIN;
+    for (i = 0; i < layout->n_glyphs; i++) {
+        ParlayGlyphPlan* gp = &layout->glyph_plans[i];
+        if (gp->glyph_index != 0) {
+            top = MAX(top,gp->y+gp->top+gp->border_thickness);
+            bottom = MIN(bottom,gp->y+gp->top+gp->height-gp->border_thickness);
+        }
+    }
+    *pbottom = bottom;
+    *ptop = top;
+}
+
+
+static int finalize_layout(ParlayContext* ctx, ParlayLayout* layout, int cropping_strategy, int fixed_width) {
+    int top, bottom, left, right;
+    ParlayGlyphPlan* gp;
+    size_t k;
+
+    if (fixed_width > 0 && layout->line_breaking == PARLAY_BREAK_OPTIMAL) {
+        if (break_lines_optimally(layout,fixed_width)) {
+            return 1407;
+        }
+    }
+
+    if (layout->first_glyph_of_current_line != layout->n_glyphs) {
+        lay_out_line(layout,0,0);
+    }
+
+    if (reorder_lines(ctx,layout,0,layout->n_glyphs)) {
+        return 1405;
+    }
+
+    switch (cropping_strategy & PARLAY_CROP_X_MASK) {
+    case PARLAY_CROP_X_NATURAL:
+        left = 0;
+        right = 0;
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            right = MAX(right,gp->x+gp->advance);
+        }
+        break;
+
+    case PARLAY_CROP_X_TIGHT:
+        get_x_glyph_bounds(layout,&left,&right);
+        break;
+
+    case PARLAY_CROP_X_WIDTH:
+        if (fixed_width == 0) {
+            return 1403;
+        }
+        get_x_glyph_bounds(layout,&left,&right);
+        right = left + fixed_width;
+        break;
+
+    case PARLAY_CROP_X_FAILSAFE:
+        get_x_glyph_bounds(layout,&left,&right);
+        left = MIN(left,0);
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            right = MAX(right,gp->x+gp->advance);
+        }
+        break;
+
+    default:
+        return 1401;
+    }
+
+    switch (cropping_strategy & PARLAY_CROP_Y_MASK) {
+    case PARLAY_CROP_Y_NATURAL:
+        top = 0;
+        if (layout->n_glyphs > 0) {
+            gp = &layout->glyph_plans[layout->n_glyphs-1];
+            bottom = gp->y+gp->ascender-gp->line_height;
+        } else {
+            bottom = 0;
+        }
+        break;
+
+    case PARLAY_CROP_Y_TIGHT:
+        get_y_glyph_bounds(layout,&bottom,&top);
+        break;
+
+    case PARLAY_CROP_Y_HEIGHT:
+        return 1404;
+
+    case PARLAY_CROP_Y_FAILSAFE:
+        get_y_glyph_bounds(layout,&bottom,&top);
+        top = MAX(top,0);
+        if (layout->n_glyphs > 0) {
+            gp = &layout->glyph_plans[layout->n_glyphs-1];
+            bottom = MIN(bottom,gp->y+gp->ascender-gp->line_height);
+        }
+        break;
+
+    default:
+        return 1402;
+    }
+
+    layout->height = top - bottom;
+    layout->y_image_offset = top;
+    layout->width = right - left;
+    layout->x_image_offset = left;
+
+    layout->first_glyph_of_current_word = (size_t)(-1);
+    layout->first_glyph_of_current_line = (size_t)(-1);
+    layout->glyph_x = -1;
+    layout->line_y_top = -1;
+
+    return 0;
+}
+
+
+static void delete_layout(ParlayLayout* layout) {
+    if (layout != NULL) {
+        release_layout_bitmaps(layout);
+        if (layout->bitmaps != NULL) {
+            free(layout->bitmaps);
+        }
+        if (layout->glyph_plans != NULL) {
+            free(layout->glyph_plans);
+        }
+        if (layout->drawn_plans != NULL) {
+            free(layout->drawn_plans);
+        }
+        free(layout);
+    }
+}
+
+
+// A right-to-left paragraph starts at the right, so left and right alignment
+// trade places
+
+static int mirror_alignment(int paragraph_level, int text_alignment) {
+    if (paragraph_level == 1) {
+        if (text_alignment == PARLAY_ALIGN_LEFT) {
+            return PARLAY_ALIGN_RIGHT;
+        } else if (text_alignment == PARLAY_ALIGN_RIGHT) {
+            return PARLAY_ALIGN_LEFT;
+        }
+    }
+    return text_alignment;
+}
+
+
+// Aligns the lines made of glyphs first to end-1.  Lines are runs of glyphs
+// on the same baseline, so the range must start at the start of a line.  A
+// line that was reordered for bidi doesn't end with its last glyph, so its
+// right edge is found the long way, and all of it is moved.  Lines in
+// right-to-left paragraphs have left and right alignment swapped.
+
+static void realign_lines(ParlayLayout* layout, size_t first, size_t end, int text_alignment) {
+    size_t i, j, first_glyph, last_glyph;
+    int line_y, right, shift, paragraph_level, line_alignment;
+    ParlayGlyphPlan* gp;
+
+    if (text_alignment == PARLAY_ALIGN_LEFT && !layout->any_rtl) {
+        return;
+    }
+
+    paragraph_level = 0;
+    i = first;
+    while (i < end) {
+        first_glyph = i;
+        if (layout->any_rtl && (i == first || layout->glyph_plans[i].starts_paragraph)) {
+            paragraph_level = get_paragraph_level(layout,i);
+        }
+        line_alignment = mirror_alignment(paragraph_level,text_alignment);
+        line_y = layout->glyph_plans[i].y;
+        last_glyph = i;
+        i++;
+        while (i < end && layout->glyph_plans[i].y == line_y) {
+            if (layout->glyph_plans[i].face_id != NULL) {
+                last_glyph = i;
+            }
+            i++;
+        }
+        if (line_alignment == PARLAY_ALIGN_LEFT) {
+            continue;
+        }
+        right = layout->glyph_plans[last_glyph].x + layout->glyph_plans[last_glyph].width;
+        if (layout->any_rtl) {
+            for (j = first_glyph; j < i; j++) {
+                gp = &layout->glyph_plans[j];
+                if (gp->face_id != NULL) {
+                    right = MAX(right,gp->x + gp->width);
+                }
+            }
+            last_glyph = i - 1;
+        }
+        shift = layout->width - right;
+        if (line_alignment == PARLAY_ALIGN_CENTER) {
+            shift /= 2;
+        }
+        if (shift > 0) {
+            for (j = first_glyph; j <= last_glyph; j++) {
+                layout->glyph_plans[j].x += shift;
+            }
+        }
+    }
+}
+
+
+static int realign(ParlayLayout* layout, int text_alignment) {
+    switch (text_alignment) {
+    case PARLAY_ALIGN_LEFT:
+    case PARLAY_ALIGN_CENTER:
+    case PARLAY_ALIGN_RIGHT:
+        realign_lines(layout,0,layout->n_glyphs,text_alignment);
+        break;
+
+    default:
+        return 1301;
+    }
+
+    // Where the image goes in a fixed width follows the first paragraph
+    layout->text_alignment = layout->any_rtl && layout->n_glyphs > 0
+            ? mirror_alignment(get_paragraph_level(layout,0),text_alignment) : text_alignment;
+    return 0;
+}
+
+
+// Colors and alphas are composited in 16 bits, in units where 255*255 is 1,
+// and only converted to bytes at the end, by truncation, the same way the old
+// float compositor converted its result.  Eight bits per channel isn't
+// enough in between: every blend would round, and where several translucent
+// layers overlap the roundings add up to more than one LSB.
+
+static __inline unsigned float_to_fixed(float x) {
+    if (x <= 0) {
+        return 0;
+    }
+    if (x >= 1) {
+        return 255*255;
+    }
+    return (unsigned)(x * (255.0f*255.0f) + 0.5f);
+}
+
+
+// Composites one pixel of straight (non-premultiplied) 16-bit RGBA in fixed
+// point.  src_alpha is coverage times alpha, in the same units.
+
+static __inline void blend_pixel(unsigned short* p, const unsigned short rgb[3], unsigned src_alpha) {
+    unsigned rem_alpha, total_alpha;
+    uint64_t inv_total;
+    if (src_alpha == 255*255 || p[3] == 0) {
+        p[0] = rgb[0];
+        p[1] = rgb[1];
+        p[2] = rgb[2];
+        p[3] = (unsigned short)src_alpha;
+        return;
+    }
+    rem_alpha = (p[3] * (255*255 - src_alpha) + 255*255/2) / (255*255);
+    total_alpha = src_alpha + rem_alpha;
+    inv_total = (((uint64_t)1 << 32) + total_alpha/2) / total_alpha;
+    p[0] = (unsigned short)(((rgb[0]*src_alpha + p[0]*rem_alpha + total_alpha/2) * inv_total) >> 32);
+    p[1] = (unsigned short)(((rgb[1]*src_alpha + p[1]*rem_alpha + total_alpha/2) * inv_total) >> 32);
+    p[2] = (unsigned short)(((rgb[2]*src_alpha + p[2]*rem_alpha + total_alpha/2) * inv_total) >> 32);
+    p[3] = (unsigned short)total_alpha;
+}
+
+
+// Span kernels blend a row of glyph coverage (or, when coverage is NULL, a
+// solid run) into a row of the work canvas.  The SIMD kernels do the same
+// blend as blend_pixel in single precision float, four or eight pixels at a
+// time, and agree with it to within a fraction of an LSB of the bytes they
+// end up as.  (They differ most where the alphas are tiny, since blend_pixel
+// rounds the source alpha to 16 bits first.)  The kernel is chosen by CPU
+// detection when a context is created, and reaches the transfer functions via
+// the canvas.
+
+static void blend_span_scalar(unsigned short* dst, const unsigned char* coverage, int n, const unsigned short rgb[3], unsigned alpha) {
+    int i;
+    if (coverage == NULL) {
+        for (i = 0; i < n; i++) {
+            blend_pixel(dst+4*i,rgb,alpha);
+        }
+    } else {
+        for (i = 0; i < n; i++) {
+            if (coverage[i] != 0) {
+                blend_pixel(dst+4*i,rgb,(coverage[i]*alpha + 127) / 255);
+            }
+        }
+    }
+}
+
+
+#if PARLAY_SIMD_X86
+
+// SSE2 can only pack 32-bit integers to 16 with signed saturation, so the
+// results are biased down by 32768 to pack, and flipped back after.
+
+PARLAY_TARGET("sse2")
+static void blend_span_sse2(unsigned short* dst, const unsigned char* coverage, int n, const unsigned short rgb[3], unsigned alpha) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi32(32768);
+    const __m128i flip = _mm_set1_epi16((short)0x8000);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 k255 = _mm_set1_ps(255.0f);
+    const __m128 full = _mm_set1_ps(255.0f*255.0f);
+    const __m128 inv_full = _mm_set1_ps(1.0f/(255.0f*255.0f));
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 unit_alpha = _mm_set1_ps(alpha / (255.0f*255.0f*255.0f));
+    const __m128 src_r = _mm_set1_ps(rgb[0]);
+    const __m128 src_g = _mm_set1_ps(rgb[1]);
+    const __m128 src_b = _mm_set1_ps(rgb[2]);
+    __m128 cov, sa, rem, total, inv_total, keep, r, g, b, a, nr, ng, nb, na;
+    __m128i px01, px23, lo, hi;
+    uint32_t cov4;
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        if (coverage != NULL) {
+            memcpy(&cov4,coverage+i,4);
+            if (cov4 == 0) {
+                continue;
+            }
+            cov = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)cov4),zero),zero));
+        } else {
+            cov = k255;
+        }
+        px01 = _mm_loadu_si128((const __m128i*)(dst+4*i));
+        px23 = _mm_loadu_si128((const __m128i*)(dst+4*i+8));
+        r = _mm_cvtepi32_ps(_mm_unpacklo_epi16(px01,zero));
+        g = _mm_cvtepi32_ps(_mm_unpackhi_epi16(px01,zero));
+        b = _mm_cvtepi32_ps(_mm_unpacklo_epi16(px23,zero));
+        a = _mm_cvtepi32_ps(_mm_unpackhi_epi16(px23,zero));
+        _MM_TRANSPOSE4_PS(r,g,b,a);
+
+        sa = _mm_mul_ps(cov,unit_alpha);
+        rem = _mm_mul_ps(_mm_mul_ps(a,inv_full),_mm_sub_ps(one,sa));
+        total = _mm_add_ps(sa,rem);
+        keep = _mm_cmpeq_ps(total,_mm_setzero_ps());
+        inv_total = _mm_div_ps(one,_mm_or_ps(total,_mm_and_ps(keep,one)));
+        sa = _mm_mul_ps(sa,inv_total);
+        rem = _mm_mul_ps(rem,inv_total);
+        nr = _mm_add_ps(_mm_mul_ps(src_r,sa),_mm_mul_ps(r,rem));
+        ng = _mm_add_ps(_mm_mul_ps(src_g,sa),_mm_mul_ps(g,rem));
+        nb = _mm_add_ps(_mm_mul_ps(src_b,sa),_mm_mul_ps(b,rem));
+        na = _mm_mul_ps(total,full);
+        nr = _mm_or_ps(_mm_and_ps(keep,r),_mm_andnot_ps(keep,nr));
+        ng = _mm_or_ps(_mm_and_ps(keep,g),_mm_andnot_ps(keep,ng));
+        nb = _mm_or_ps(_mm_and_ps(keep,b),_mm_andnot_ps(keep,nb));
+        na = _mm_or_ps(_mm_and_ps(keep,a),_mm_andnot_ps(keep,na));
+
+        _MM_TRANSPOSE4_PS(nr,ng,nb,na);
+        lo = _mm_packs_epi32(_mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(nr,half)),bias),
+                _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(ng,half)),bias));
+        hi = _mm_packs_epi32(_mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(nb,half)),bias),
+                _mm_sub_epi32(_mm_cvttps_epi32(_mm_add_ps(na,half)),bias));
+        _mm_storeu_si128((__m128i*)(dst+4*i),_mm_xor_si128(lo,flip));
+        _mm_storeu_si128((__m128i*)(dst+4*i+8),_mm_xor_si128(hi,flip));
+    }
+    blend_span_scalar(dst+4*i,coverage ? coverage+i : NULL,n-i,rgb,alpha);
+}
+
+
+// Each 128-bit lane of an AVX register holds two pixels once they're widened
+// to 32 bits, so the transpose below is the SSE2 one done lane by lane, and
+// leaves the eight pixels in the order 0, 1, 4, 5, 2, 3, 6, 7.  The coverage
+// is put in the same order, and packing undoes it.
+
+#define TRANSPOSE4_256(r0,r1,r2,r3) do { \
+        __m256 t0 = _mm256_unpacklo_ps(r0,r1); \
+        __m256 t1 = _mm256_unpacklo_ps(r2,r3); \
+        __m256 t2 = _mm256_unpackhi_ps(r0,r1); \
+        __m256 t3 = _mm256_unpackhi_ps(r2,r3); \
+        r0 = _mm256_shuffle_ps(t0,t1,0x44); \
+        r1 = _mm256_shuffle_ps(t0,t1,0xEE); \
+        r2 = _mm256_shuffle_ps(t2,t3,0x44); \
+        r3 = _mm256_shuffle_ps(t2,t3,0xEE); \
+    } while (0)
+
+PARLAY_TARGET("avx2")
+static void blend_span_avx2(unsigned short* dst, const unsigned char* coverage, int n, const unsigned short rgb[3], unsigned alpha) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i order = _mm256_setr_epi32(0,1,4,5,2,3,6,7);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 k255 = _mm256_set1_ps(255.0f);
+    const __m256 full = _mm256_set1_ps(255.0f*255.0f);
+    const __m256 inv_full = _mm256_set1_ps(1.0f/(255.0f*255.0f));
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 unit_alpha = _mm256_set1_ps(alpha / (255.0f*255.0f*255.0f));
+    const __m256 src_r = _mm256_set1_ps(rgb[0]);
+    const __m256 src_g = _mm256_set1_ps(rgb[1]);
+    const __m256 src_b = _mm256_set1_ps(rgb[2]);
+    __m256 cov, sa, rem, total, inv_total, keep, r, g, b, a, nr, ng, nb, na;
+    __m256i px03, px47;
+    uint64_t cov8;
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        if (coverage != NULL) {
+            memcpy(&cov8,coverage+i,8);
+            if (cov8 == 0) {
+                continue;
+            }
+            cov = _mm256_cvtepi32_ps(_mm256_permutevar8x32_epi32(
+                    _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(coverage+i))),order));
+        } else {
+            cov = k255;
+        }
+        px03 = _mm256_loadu_si256((const __m256i*)(dst+4*i));
+        px47 = _mm256_loadu_si256((const __m256i*)(dst+4*i+16));
+        r = _mm256_cvtepi32_ps(_mm256_unpacklo_epi16(px03,zero));
+        g = _mm256_cvtepi32_ps(_mm256_unpackhi_epi16(px03,zero));
+        b = _mm256_cvtepi32_ps(_mm256_unpacklo_epi16(px47,zero));
+        a = _mm256_cvtepi32_ps(_mm256_unpackhi_epi16(px47,zero));
+        TRANSPOSE4_256(r,g,b,a);
+
+        sa = _mm256_mul_ps(cov,unit_alpha);
+        rem = _mm256_mul_ps(_mm256_mul_ps(a,inv_full),_mm256_sub_ps(one,sa));
+        total = _mm256_add_ps(sa,rem);
+        keep = _mm256_cmp_ps(total,_mm256_setzero_ps(),_CMP_EQ_OQ);
+        inv_total = _mm256_div_ps(one,_mm256_or_ps(total,_mm256_and_ps(keep,one)));
+        sa = _mm256_mul_ps(sa,inv_total);
+        rem = _mm256_mul_ps(rem,inv_total);
+        nr = _mm256_add_ps(_mm256_mul_ps(src_r,sa),_mm256_mul_ps(r,rem));
+        ng = _mm256_add_ps(_mm256_mul_ps(src_g,sa),_mm256_mul_ps(g,rem));
+        nb = _mm256_add_ps(_mm256_mul_ps(src_b,sa),_mm256_mul_ps(b,rem));
+        na = _mm256_mul_ps(total,full);
+        nr = _mm256_blendv_ps(nr,r,keep);
+        ng = _mm256_blendv_ps(ng,g,keep);
+        nb = _mm256_blendv_ps(nb,b,keep);
+        na = _mm256_blendv_ps(na,a,keep);
+
+        TRANSPOSE4_256(nr,ng,nb,na);
+        px03 = _mm256_packus_epi32(_mm256_cvttps_epi32(_mm256_add_ps(nr,half)),_mm256_cvttps_epi32(_mm256_add_ps(ng,half)));
+        px47 = _mm256_packus_epi32(_mm256_cvttps_epi32(_mm256_add_ps(nb,half)),_mm256_cvttps_epi32(_mm256_add_ps(na,half)));
+        _mm256_storeu_si256((__m256i*)(dst+4*i),px03);
+        _mm256_storeu_si256((__m256i*)(dst+4*i+16),px47);
+    }
+    blend_span_sse2(dst+4*i,coverage ? coverage+i : NULL,n-i,rgb,alpha);
+}
+
+
+static int cpu_has_sse2(void) {
+#if defined(__x86_64__) || defined(_M_X64)
+    return 1;
+#elif defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info,1);
+    return (info[3] & (1<<26)) != 0;
+#else
+    return 0;
+#endif
+}
+
+
+static int cpu_has_avx2(void) {
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info,0);
+    if (info[0] < 7) {
+        return 0;
+    }
+    __cpuid(info,1);
+    if ((info[2] & (1<<27)) == 0 || (info[2] & (1<<28)) == 0) {
+        return 0;
+    }
+    if ((_xgetbv(0) & 6) != 6) {
+        return 0;
+    }
+    __cpuidex(info,7,0);
+    return (info[1] & (1<<5)) != 0;
+#else
+    return 0;
+#endif
+}
+
+#endif
+
+
+#if PARLAY_SIMD_NEON
+
+// ARMv7 NEON has no vector divide, so the reciprocal is an estimate refined
+// by two Newton-Raphson steps, which is plenty for 16-bit results.
+
+static __inline float32x4_t neon_reciprocal(float32x4_t x) {
+    float32x4_t e = vrecpeq_f32(x);
+    e = vmulq_f32(e,vrecpsq_f32(x,e));
+    e = vmulq_f32(e,vrecpsq_f32(x,e));
+    return e;
+}
+
+
+static __inline void neon_blend4(float32x4_t cov, float32x4_t unit_alpha, const unsigned short rgb[3],
+        float32x4_t* r, float32x4_t* g, float32x4_t* b, float32x4_t* a) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t sa, rem, total, inv_total;
+    uint32x4_t keep;
+    sa = vmulq_f32(cov,unit_alpha);
+    rem = vmulq_f32(vmulq_n_f32(*a,1.0f/(255.0f*255.0f)),vsubq_f32(one,sa));
+    total = vaddq_f32(sa,rem);
+    keep = vceqq_f32(total,vdupq_n_f32(0.0f));
+    inv_total = neon_reciprocal(vbslq_f32(keep,one,total));
+    sa = vmulq_f32(sa,inv_total);
+    rem = vmulq_f32(rem,inv_total);
+    *r = vbslq_f32(keep,*r,vaddq_f32(vmulq_n_f32(sa,rgb[0]),vmulq_f32(*r,rem)));
+    *g = vbslq_f32(keep,*g,vaddq_f32(vmulq_n_f32(sa,rgb[1]),vmulq_f32(*g,rem)));
+    *b = vbslq_f32(keep,*b,vaddq_f32(vmulq_n_f32(sa,rgb[2]),vmulq_f32(*b,rem)));
+    *a = vbslq_f32(keep,*a,vmulq_n_f32(total,255.0f*255.0f));
+}
+
+
+static __inline float32x4_t neon_widen_low(uint16x8_t v) {
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(v)));
+}
+
+
+static __inline float32x4_t neon_widen_high(uint16x8_t v) {
+    return vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)));
+}
+
+
+static __inline uint16x8_t neon_narrow(float32x4_t lo, float32x4_t hi) {
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    uint16x4_t l = vqmovn_u32(vcvtq_u32_f32(vaddq_f32(lo,half)));
+    uint16x4_t h = vqmovn_u32(vcvtq_u32_f32(vaddq_f32(hi,half)));
+    return vcombine_u16(l,h);
+}
+
+
+// vld4q_u16 loads eight pixels with their channels already split apart, so
+// unlike the x86 kernels this one needs no transposing.
+
+static void blend_span_neon(unsigned short* dst, const unsigned char* coverage, int n, const unsigned short rgb[3], unsigned alpha) {
+    const float32x4_t unit_alpha = vdupq_n_f32(alpha / (255.0f*255.0f*255.0f));
+    float32x4_t cov_lo, cov_hi, r_lo, r_hi, g_lo, g_hi, b_lo, b_hi, a_lo, a_hi;
+    uint16x8_t cov16;
+    uint16x8x4_t px;
+    uint64_t cov_bits;
+    int i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        if (coverage != NULL) {
+            memcpy(&cov_bits,coverage+i,8);
+            if (cov_bits == 0) {
+                continue;
+            }
+            cov16 = vmovl_u8(vld1_u8(coverage+i));
+        } else {
+            cov16 = vdupq_n_u16(255);
+        }
+        px = vld4q_u16(dst+4*i);
+        cov_lo = neon_widen_low(cov16);
+        cov_hi = neon_widen_high(cov16);
+        r_lo = neon_widen_low(px.val[0]);
+        r_hi = neon_widen_high(px.val[0]);
+        g_lo = neon_widen_low(px.val[1]);
+        g_hi = neon_widen_high(px.val[1]);
+        b_lo = neon_widen_low(px.val[2]);
+        b_hi = neon_widen_high(px.val[2]);
+        a_lo = neon_widen_low(px.val[3]);
+        a_hi = neon_widen_high(px.val[3]);
+        neon_blend4(cov_lo,unit_alpha,rgb,&r_lo,&g_lo,&b_lo,&a_lo);
+        neon_blend4(cov_hi,unit_alpha,rgb,&r_hi,&g_hi,&b_hi,&a_hi);
+        px.val[0] = neon_narrow(r_lo,r_hi);
+        px.val[1] = neon_narrow(g_lo,g_hi);
+        px.val[2] = neon_narrow(b_lo,b_hi);
+        px.val[3] = neon_narrow(a_lo,a_hi);
+        vst4q_u16(dst+4*i,px);
+    }
+    blend_span_scalar(dst+4*i,coverage ? coverage+i : NULL,n-i,rgb,alpha);
+}
+
+#endif
+
+
+static BlendSpanFunction select_blend_span(void) {
+#if PARLAY_SIMD_X86
+    if (cpu_has_avx2()) {
+        return blend_span_avx2;
+    } else if (cpu_has_sse2()) {
+        return blend_span_sse2;
+    }
+#elif PARLAY_SIMD_NEON
+    return blend_span_neon;
+#endif
+    return blend_span_scalar;
+}
+
+
+// ASCII span kernels, for check_utf8 and decode_utf8.  Each tests a whole
+// vector of bytes for high bits at once, and widens them to code points when
+// asked to; the first vector with a non-ASCII byte in it is finished by the
+// scalar kernel, which finds exactly where the ASCII stops.
+
+#if PARLAY_SIMD_X86
+
+PARLAY_TARGET("sse2")
+static size_t ascii_span_sse2(const unsigned char* s, size_t n, codepoint_t* out) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v, lo, hi;
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        v = _mm_loadu_si128((const __m128i*)(s+i));
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        if (out != NULL) {
+            lo = _mm_unpacklo_epi8(v,zero);
+            hi = _mm_unpackhi_epi8(v,zero);
+            _mm_storeu_si128((__m128i*)(out+i),_mm_unpacklo_epi16(lo,zero));
+            _mm_storeu_si128((__m128i*)(out+i+4),_mm_unpackhi_epi16(lo,zero));
+            _mm_storeu_si128((__m128i*)(out+i+8),_mm_unpacklo_epi16(hi,zero));
+            _mm_storeu_si128((__m128i*)(out+i+12),_mm_unpackhi_epi16(hi,zero));
+        }
+    }
+    return i + ascii_span_scalar(s+i,n-i,out ? out+i : NULL);
+}
+
+
+PARLAY_TARGET("avx2")
+static size_t ascii_span_avx2(const unsigned char* s, size_t n, codepoint_t* out) {
+    __m256i v;
+    size_t i;
+
+    for (i = 0; i + 32 <= n; i += 32) {
+        v = _mm256_loadu_si256((const __m256i*)(s+i));
+        if (_mm256_movemask_epi8(v) != 0) {
+            break;
+        }
+        if (out != NULL) {
+            _mm256_storeu_si256((__m256i*)(out+i),_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(s+i))));
+            _mm256_storeu_si256((__m256i*)(out+i+8),_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(s+i+8))));
+            _mm256_storeu_si256((__m256i*)(out+i+16),_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(s+i+16))));
+            _mm256_storeu_si256((__m256i*)(out+i+24),_mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(s+i+24))));
+        }
+    }
+    return i + ascii_span_scalar(s+i,n-i,out ? out+i : NULL);
+}
+
+
+// The AVX2 check is the lookup algorithm of Keiser and Lemire ("Validating
+// UTF-8 In Less Than One Instruction Per Byte").  Three table lookups, on the
+// high and low nibbles of the byte before and the high nibble of each byte,
+// find every bad pair of bytes; a saturating subtract finds where the third
+// and fourth bytes of a character must be.  It only says whether the text is
+// valid; the scalar check finds where it isn't.
+
+#define UTF8_PREV_BYTES(input,prev_input,n) \
+        _mm256_alignr_epi8((input),_mm256_permute2x128_si256((prev_input),(input),0x21),16-(n))
+
+PARLAY_TARGET("avx2")
+static int check_utf8_avx2(const unsigned char* s, size_t n, size_t* roffset) {
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i byte_1_high = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+            UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG,
+            UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG,
+            UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS,
+            UTF8_ERR_TOO_SHORT|UTF8_ERR_OVERLONG_2,
+            UTF8_ERR_TOO_SHORT,
+            UTF8_ERR_TOO_SHORT|UTF8_ERR_OVERLONG_3|UTF8_ERR_SURROGATE,
+            UTF8_ERR_TOO_SHORT|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_OVERLONG_4));
+    const __m256i byte_1_low = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+            UTF8_ERR_CARRY|UTF8_ERR_OVERLONG_3|UTF8_ERR_OVERLONG_2|UTF8_ERR_OVERLONG_4,
+            UTF8_ERR_CARRY|UTF8_ERR_OVERLONG_2,
+            UTF8_ERR_CARRY,
+            UTF8_ERR_CARRY,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_SURROGATE,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+            UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000));
+    const __m256i byte_2_high = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+            UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT,
+            UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT,
+            (char)(UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_OVERLONG_3
+                    |UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_OVERLONG_4),
+            (char)(UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_OVERLONG_3|UTF8_ERR_TOO_LARGE),
+            (char)(UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_SURROGATE|UTF8_ERR_TOO_LARGE),
+            (char)(UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_SURROGATE|UTF8_ERR_TOO_LARGE),
+            UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT));
+    // A block can't end partway through a character: its last byte can't be
+    // a lead byte, nor its second to last a three or four byte lead, nor its
+    // third to last a four byte lead
+    const __m256i incomplete_limit = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0-1), (char)(0xE0-1), (char)(0xC0-1));
+    __m256i input, prev_input, prev1, prev2, prev3, special, must_continue, errors, prev_incomplete;
+    unsigned char tail[32];
+    size_t i;
+
+    prev_input = _mm256_setzero_si256();
+    prev_incomplete = _mm256_setzero_si256();
+    errors = _mm256_setzero_si256();
+    for (i = 0; i < n; i += 32) {
+        if (n - i >= 32) {
+            input = _mm256_loadu_si256((const __m256i*)(s+i));
+        } else {
+            // The tail is padded with zeros, which pass as ASCII
+            memset(tail,0,32);
+            memcpy(tail,s+i,n-i);
+            input = _mm256_loadu_si256((const __m256i*)tail);
+        }
+        if (_mm256_movemask_epi8(input) == 0) {
+            errors = _mm256_or_si256(errors,prev_incomplete);
+            prev_incomplete = _mm256_setzero_si256();
+        } else {
+            prev1 = UTF8_PREV_BYTES(input,prev_input,1);
+            prev2 = UTF8_PREV_BYTES(input,prev_input,2);
+            prev3 = UTF8_PREV_BYTES(input,prev_input,3);
+            special = _mm256_and_si256(
+                    _mm256_and_si256(
+                        _mm256_shuffle_epi8(byte_1_high,_mm256_and_si256(_mm256_srli_epi16(prev1,4),nibble)),
+                        _mm256_shuffle_epi8(byte_1_low,_mm256_and_si256(prev1,nibble))),
+                    _mm256_shuffle_epi8(byte_2_high,_mm256_and_si256(_mm256_srli_epi16(input,4),nibble)));
+            must_continue = _mm256_and_si256(
+                    _mm256_or_si256(_mm256_subs_epu8(prev2,_mm256_set1_epi8((char)(0xE0-0x80))),
+                        _mm256_subs_epu8(prev3,_mm256_set1_epi8((char)(0xF0-0x80)))),
+                    _mm256_set1_epi8((char)0x80));
+            errors = _mm256_or_si256(errors,_mm256_xor_si256(must_continue,special));
+            prev_incomplete = _mm256_subs_epu8(input,incomplete_limit);
+        }
+        if (!_mm256_testz_si256(errors,errors)) {
+            break;
+        }
+        prev_input = input;
+    }
+    errors = _mm256_or_si256(errors,prev_incomplete);
+    if (!_mm256_testz_si256(errors,errors)) {
+        return check_utf8(s,n,roffset);
+    }
+    return 0;
+}
+
+
+// SSE2 has no byte shuffle to look things up with, so the SSE2 check works
+// out the same three lookups from comparisons.  Every table entry only
+// depends on which range its byte falls in, and there are only a few of
+// those: ASCII, continuation bytes and their first quarter and half, and
+// the two, three, and four byte leads.  Otherwise it's the AVX2 check, 16
+// bytes at a time.
+
+#define UTF8_PREV_BYTES_SSE2(input,prev_input,n) \
+        _mm_or_si128(_mm_slli_si128((input),(n)),_mm_srli_si128((prev_input),16-(n)))
+#define UTF8_AT_LEAST(v,limit) _mm_cmpeq_epi8(_mm_max_epu8((v),_mm_set1_epi8((char)(limit))),(v))
+#define UTF8_IF(mask,flags) _mm_and_si128((mask),_mm_set1_epi8((char)(flags)))
+
+PARLAY_TARGET("sse2")
+static int check_utf8_sse2(const unsigned char* s, size_t n, size_t* roffset) {
+    const __m128i incomplete_limit = _mm_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0-1), (char)(0xE0-1), (char)(0xC0-1));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i input, prev_input, prev1, prev2, prev3, low, special, must_continue, errors, prev_incomplete;
+    __m128i ge80, geC0, geD0, geE0, geF0, cont, byte_1_high, byte_1_low, byte_2_high;
+    unsigned char tail[16];
+    size_t i;
+
+    prev_input = zero;
+    prev_incomplete = zero;
+    errors = zero;
+    for (i = 0; i < n; i += 16) {
+        if (n - i >= 16) {
+            input = _mm_loadu_si128((const __m128i*)(s+i));
+        } else {
+            // The tail is padded with zeros, which pass as ASCII
+            memset(tail,0,16);
+            memcpy(tail,s+i,n-i);
+            input = _mm_loadu_si128((const __m128i*)tail);
+        }
+        if (_mm_movemask_epi8(input) == 0) {
+            errors = _mm_or_si128(errors,prev_incomplete);
+            prev_incomplete = zero;
+        } else {
+            prev1 = UTF8_PREV_BYTES_SSE2(input,prev_input,1);
+            prev2 = UTF8_PREV_BYTES_SSE2(input,prev_input,2);
+            prev3 = UTF8_PREV_BYTES_SSE2(input,prev_input,3);
+
+            // By the high nibble of the byte before
+            ge80 = UTF8_AT_LEAST(prev1,0x80);
+            geC0 = UTF8_AT_LEAST(prev1,0xC0);
+            geD0 = UTF8_AT_LEAST(prev1,0xD0);
+            geE0 = UTF8_AT_LEAST(prev1,0xE0);
+            geF0 = UTF8_AT_LEAST(prev1,0xF0);
+            byte_1_high = _mm_or_si128(
+                    _mm_or_si128(_mm_andnot_si128(ge80,_mm_set1_epi8(UTF8_ERR_TOO_LONG)),
+                        UTF8_IF(_mm_andnot_si128(geC0,ge80),UTF8_ERR_TWO_CONTS)),
+                    _mm_or_si128(
+                        _mm_or_si128(UTF8_IF(geC0,UTF8_ERR_TOO_SHORT),
+                            UTF8_IF(_mm_andnot_si128(geD0,geC0),UTF8_ERR_OVERLONG_2)),
+                        _mm_or_si128(UTF8_IF(_mm_andnot_si128(geF0,geE0),UTF8_ERR_OVERLONG_3|UTF8_ERR_SURROGATE),
+                            UTF8_IF(geF0,UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_OVERLONG_4))));
+
+            // By its low nibble, which fits a signed comparison
+            low = _mm_and_si128(prev1,_mm_set1_epi8(0x0F));
+            byte_1_low = _mm_or_si128(
+                    _mm_or_si128(_mm_set1_epi8(UTF8_ERR_CARRY),
+                        UTF8_IF(_mm_cmplt_epi8(low,_mm_set1_epi8(2)),UTF8_ERR_OVERLONG_2)),
+                    _mm_or_si128(
+                        _mm_or_si128(UTF8_IF(_mm_cmpeq_epi8(low,zero),UTF8_ERR_OVERLONG_3|UTF8_ERR_OVERLONG_4),
+                            UTF8_IF(_mm_cmpeq_epi8(low,_mm_set1_epi8(0x0D)),UTF8_ERR_SURROGATE)),
+                        _mm_or_si128(UTF8_IF(_mm_cmpgt_epi8(low,_mm_set1_epi8(3)),UTF8_ERR_TOO_LARGE),
+                            UTF8_IF(_mm_cmpgt_epi8(low,_mm_set1_epi8(4)),UTF8_ERR_TOO_LARGE_1000))));
+
+            // By the high nibble of the byte itself
+            cont = _mm_andnot_si128(UTF8_AT_LEAST(input,0xC0),UTF8_AT_LEAST(input,0x80));
+            byte_2_high = _mm_or_si128(
+                    _mm_or_si128(_mm_andnot_si128(cont,_mm_set1_epi8(UTF8_ERR_TOO_SHORT)),
+                        UTF8_IF(cont,UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS)),
+                    _mm_and_si128(cont,_mm_or_si128(
+                        _mm_or_si128(_mm_andnot_si128(UTF8_AT_LEAST(input,0xA0),_mm_set1_epi8(UTF8_ERR_OVERLONG_3)),
+                            _mm_andnot_si128(UTF8_AT_LEAST(input,0x90),
+                                _mm_set1_epi8(UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_OVERLONG_4))),
+                        _mm_or_si128(UTF8_IF(UTF8_AT_LEAST(input,0x90),UTF8_ERR_TOO_LARGE),
+                            UTF8_IF(UTF8_AT_LEAST(input,0xA0),UTF8_ERR_SURROGATE)))));
+
+            special = _mm_and_si128(_mm_and_si128(byte_1_high,byte_1_low),byte_2_high);
+            must_continue = _mm_and_si128(
+                    _mm_or_si128(_mm_subs_epu8(prev2,_mm_set1_epi8((char)(0xE0-0x80))),
+                        _mm_subs_epu8(prev3,_mm_set1_epi8((char)(0xF0-0x80)))),
+                    _mm_set1_epi8((char)0x80));
+            errors = _mm_or_si128(errors,_mm_xor_si128(must_continue,special));
+            prev_incomplete = _mm_subs_epu8(input,incomplete_limit);
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(errors,zero)) != 0xFFFF) {
+            break;
+        }
+        prev_input = input;
+    }
+    errors = _mm_or_si128(errors,prev_incomplete);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(errors,zero)) != 0xFFFF) {
+        return check_utf8(s,n,roffset);
+    }
+    return 0;
+}
+
+#endif
+
+
+#if PARLAY_SIMD_NEON
+
+static size_t ascii_span_neon(const unsigned char* s, size_t n, codepoint_t* out) {
+    uint8x16_t v;
+    uint16x8_t lo, hi;
+    size_t i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        v = vld1q_u8(s+i);
+        if (vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(v),vget_high_u8(v))),0) & 0x8080808080808080ULL) {
+            break;
+        }
+        if (out != NULL) {
+            lo = vmovl_u8(vget_low_u8(v));
+            hi = vmovl_u8(vget_high_u8(v));
+            vst1q_u32((uint32_t*)(out+i),vmovl_u16(vget_low_u16(lo)));
+            vst1q_u32((uint32_t*)(out+i+4),vmovl_u16(vget_high_u16(lo)));
+            vst1q_u32((uint32_t*)(out+i+8),vmovl_u16(vget_low_u16(hi)));
+            vst1q_u32((uint32_t*)(out+i+12),vmovl_u16(vget_high_u16(hi)));
+        }
+    }
+    return i + ascii_span_scalar(s+i,n-i,out ? out+i : NULL);
+}
+
+
+// The NEON check is the AVX2 one 16 bytes at a time.  AArch64 looks the
+// tables up with one instruction; 32-bit ARM only has 8-byte lookups, so it
+// does each half on its own.
+
+static uint8x16_t utf8_lookup_neon(uint8x16_t table, uint8x16_t index) {
+#if defined(__aarch64__)
+    return vqtbl1q_u8(table,index);
+#else
+    uint8x8x2_t halves;
+    halves.val[0] = vget_low_u8(table);
+    halves.val[1] = vget_high_u8(table);
+    return vcombine_u8(vtbl2_u8(halves,vget_low_u8(index)),vtbl2_u8(halves,vget_high_u8(index)));
+#endif
+}
+
+
+static int any_bits_neon(uint8x16_t v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vorr_u8(vget_low_u8(v),vget_high_u8(v))),0) != 0;
+}
+
+
+static int check_utf8_neon(const unsigned char* s, size_t n, size_t* roffset) {
+    static const unsigned char byte_1_high_table[16] = {
+        UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG,
+        UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG, UTF8_ERR_TOO_LONG,
+        UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS, UTF8_ERR_TWO_CONTS,
+        UTF8_ERR_TOO_SHORT|UTF8_ERR_OVERLONG_2,
+        UTF8_ERR_TOO_SHORT,
+        UTF8_ERR_TOO_SHORT|UTF8_ERR_OVERLONG_3|UTF8_ERR_SURROGATE,
+        UTF8_ERR_TOO_SHORT|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_OVERLONG_4 };
+    static const unsigned char byte_1_low_table[16] = {
+        UTF8_ERR_CARRY|UTF8_ERR_OVERLONG_3|UTF8_ERR_OVERLONG_2|UTF8_ERR_OVERLONG_4,
+        UTF8_ERR_CARRY|UTF8_ERR_OVERLONG_2,
+        UTF8_ERR_CARRY,
+        UTF8_ERR_CARRY,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000|UTF8_ERR_SURROGATE,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000,
+        UTF8_ERR_CARRY|UTF8_ERR_TOO_LARGE|UTF8_ERR_TOO_LARGE_1000 };
+    static const unsigned char byte_2_high_table[16] = {
+        UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT,
+        UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT,
+        UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_OVERLONG_3|UTF8_ERR_TOO_LARGE_1000
+                |UTF8_ERR_OVERLONG_4,
+        UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_OVERLONG_3|UTF8_ERR_TOO_LARGE,
+        UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_SURROGATE|UTF8_ERR_TOO_LARGE,
+        UTF8_ERR_TOO_LONG|UTF8_ERR_OVERLONG_2|UTF8_ERR_TWO_CONTS|UTF8_ERR_SURROGATE|UTF8_ERR_TOO_LARGE,
+        UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT, UTF8_ERR_TOO_SHORT };
+    static const unsigned char incomplete_limit_table[16] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0-1, 0xE0-1, 0xC0-1 };
+    const uint8x16_t byte_1_high = vld1q_u8(byte_1_high_table);
+    const uint8x16_t byte_1_low = vld1q_u8(byte_1_low_table);
+    const uint8x16_t byte_2_high = vld1q_u8(byte_2_high_table);
+    const uint8x16_t incomplete_limit = vld1q_u8(incomplete_limit_table);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    uint8x16_t input, prev_input, prev1, prev2, prev3, special, must_continue, errors, prev_incomplete;
+    unsigned char tail[16];
+    size_t i;
+
+    prev_input = vdupq_n_u8(0);
+    prev_incomplete = vdupq_n_u8(0);
+    errors = vdupq_n_u8(0);
+    for (i = 0; i < n; i += 16) {
+        if (n - i >= 16) {
+            input = vld1q_u8(s+i);
+        } else {
+            // The tail is padded with zeros, which pass as ASCII
+            memset(tail,0,16);
+            memcpy(tail,s+i,n-i);
+            input = vld1q_u8(tail);
+        }
+        if (!any_bits_neon(vandq_u8(input,vdupq_n_u8(0x80)))) {
+            errors = vorrq_u8(errors,prev_incomplete);
+            prev_incomplete = vdupq_n_u8(0);
+        } else {
+            prev1 = vextq_u8(prev_input,input,15);
+            prev2 = vextq_u8(prev_input,input,14);
+            prev3 = vextq_u8(prev_input,input,13);
+            special = vandq_u8(
+                    vandq_u8(utf8_lookup_neon(byte_1_high,vshrq_n_u8(prev1,4)),
+                        utf8_lookup_neon(byte_1_low,vandq_u8(prev1,nibble))),
+                    utf8_lookup_neon(byte_2_high,vshrq_n_u8(input,4)));
+            must_continue = vandq_u8(
+                    vorrq_u8(vqsubq_u8(prev2,vdupq_n_u8(0xE0-0x80)),vqsubq_u8(prev3,vdupq_n_u8(0xF0-0x80))),
+                    vdupq_n_u8(0x80));
+            errors = vorrq_u8(errors,veorq_u8(must_continue,special));
+            prev_incomplete = vqsubq_u8(input,incomplete_limit);
+        }
+        if (any_bits_neon(errors)) {
+            break;
+        }
+        prev_input = input;
+    }
+    if (any_bits_neon(vorrq_u8(errors,prev_incomplete))) {
+        return check_utf8(s,n,roffset);
+    }
+    return 0;
+}
+
+#endif
+
+
+static AsciiSpanFunction select_ascii_span(void) {
+#if PARLAY_SIMD_X86
+    if (cpu_has_avx2()) {
+        return ascii_span_avx2;
+    } else if (cpu_has_sse2()) {
+        return ascii_span_sse2;
+    }
+#elif PARLAY_SIMD_NEON
+    return ascii_span_neon;
+#endif
+    return ascii_span_scalar;
+}
+
+
+static Utf8CheckFunction select_check_utf8(void) {
+#if PARLAY_SIMD_X86
+    if (cpu_has_avx2()) {
+        return check_utf8_avx2;
+    } else if (cpu_has_sse2()) {
+        return check_utf8_sse2;
+    }
+#elif PARLAY_SIMD_NEON
+    return check_utf8_neon;
+#endif
+    return check_utf8;
+}
+
+
+static void transfer_rect(ParlayCanvas* canvas, int x, int y, int width, int height, const float rgb[3], float alpha) {
+    int j, imin, imax, jmin, jmax;
+    unsigned short color[3];
+    unsigned a;
+
+    a = float_to_fixed(alpha);
+    if (a == 0) {
+        return;
+    }
+    color[0] = (unsigned short)float_to_fixed(rgb[0]);
+    color[1] = (unsigned short)float_to_fixed(rgb[1]);
+    color[2] = (unsigned short)float_to_fixed(rgb[2]);
+
+    x -= canvas->x_origin;
+    y -= canvas->y_origin;
+    imin = MAX(0,-x);
+    imax = MAX(0,MIN(width,canvas->width-x));
+    jmin = MAX(0,-y);
+    jmax = MAX(0,MIN(height,canvas->height-y));
+    for (j = jmin; j < jmax; j++) {
+        canvas->blend_span(canvas->work+((size_t)(y+j)*canvas->width+x+imin)*4,NULL,imax-imin,color,a);
+    }
+}
+
+
+static void transfer_buffer(ParlayCanvas* canvas, const unsigned char* buffer, int x, int y, int width, int height, const float rgb[3], float alpha) {
+    int j, imin, imax, jmin, jmax;
+    unsigned short color[3];
+    unsigned a;
+
+    a = float_to_fixed(alpha);
+    if (a == 0) {
+        return;
+    }
+    color[0] = (unsigned short)float_to_fixed(rgb[0]);
+    color[1] = (unsigned short)float_to_fixed(rgb[1]);
+    color[2] = (unsigned short)float_to_fixed(rgb[2]);
+
+    x -= canvas->x_origin;
+    y -= canvas->y_origin;
+    imin = MAX(0,-x);
+    imax = MAX(0,MIN(width,canvas->width-x));
+    jmin = MAX(0,-y);
+    jmax = MAX(0,MIN(height,canvas->height-y));
+    for (j = jmin; j < jmax; j++) {
+        canvas->blend_span(canvas->work+((size_t)(y+j)*canvas->width+x+imin)*4,buffer+j*width+imin,imax-imin,color,a);
+    }
+}
+
+
+static void transfer_mask(ParlayCanvas* canvas, const unsigned short* mask, int x, int y, int width, int height, const float rgb[3]) {
+    int i, j, imin, imax, jmin, jmax;
+    unsigned short color[3];
+    const unsigned short* src;
+    unsigned short* row;
+
+    color[0] = (unsigned short)float_to_fixed(rgb[0]);
+    color[1] = (unsigned short)float_to_fixed(rgb[1]);
+    color[2] = (unsigned short)float_to_fixed(rgb[2]);
+
+    x -= canvas->x_origin;
+    y -= canvas->y_origin;
+    imin = MAX(0,-x);
+    imax = MAX(0,MIN(width,canvas->width-x));
+    jmin = MAX(0,-y);
+    jmax = MAX(0,MIN(height,canvas->height-y));
+    for (j = jmin; j < jmax; j++) {
+        src = mask + j * width + imin;
+        row = canvas->work + ((size_t)(y+j) * canvas->width + x+imin) * 4;
+        for (i = imin; i < imax; i++) {
+            if (*src != 255*255) {
+                blend_pixel(row,color,255*255-*src);
+            }
+            src++;
+            row += 4;
+        }
+    }
+}
+
+
+static int reserve_scratch(ParlayScratch* scratch, size_t n) {
+    unsigned short* data;
+    if (n <= scratch->cap) {
+        return 0;
+    }
+    data = (unsigned short*)malloc(n*sizeof(unsigned short));
+    if (data == NULL) {
+        return 1;
+    }
+    if (scratch->data != NULL) {
+        free(scratch->data);
+    }
+    scratch->data = data;
+    scratch->cap = n;
+    return 0;
+}
+
+
+// A border is drawn by compositing the glyph in the border color at every
+// offset within the border thickness.  Compositing one color over and over is
+// the same as compositing it once with the combined alpha, so the passes are
+// accumulated into a mask of remaining transparency (255*255 being fully
+// transparent) which is blended into the canvas once.  A NULL buffer means
+// a solid rectangle.
+
+static int smear_buffer(ParlayCanvas* canvas, ParlayScratch* scratch, const unsigned char* buffer, int x, int y, int width, int height, const float rgb[3], float alpha, int bt) {
+    int i, j, u, v, mask_width, mask_height;
+    unsigned cov, a, tap_alpha;
+    float r;
+    unsigned short* mask;
+    unsigned short* mrow;
+
+    if (bt == 0 || width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    mask_width = width + 2*bt + 2;
+    mask_height = height + 2*bt + 2;
+    if (reserve_scratch(scratch,(size_t)mask_width*mask_height)) {
+        return 1;
+    }
+    mask = scratch->data;
+    for (i = 0; i < mask_width*mask_height; i++) {
+        mask[i] = 255*255;
+    }
+
+    for (i = -bt; i <= bt; i++) {
+        for (j = -bt; j <= bt; j++) {
+            r = sqrt(i*i+j*j);
+            if (r <= bt) {
+                tap_alpha = float_to_fixed(alpha);
+            } else if (r <= bt+1) {
+                tap_alpha = float_to_fixed(alpha*(bt+1-r));
+            } else {
+                continue;
+            }
+            if (tap_alpha == 0) {
+                continue;
+            }
+            for (v = 0; v < height; v++) {
+                mrow = mask + (v+j+bt+1) * mask_width + (i+bt+1);
+                for (u = 0; u < width; u++) {
+                    cov = (buffer == NULL) ? 255 : buffer[v*width+u];
+                    if (cov != 0) {
+                        a = (cov * tap_alpha + 127) / 255;
+                        mrow[u] = (unsigned short)((mrow[u] * (255*255 - a) + 255*255/2) / (255*255));
+                    }
+                }
+            }
+        }
+    }
+
+    transfer_mask(canvas,mask,x-bt-1,y-bt-1,mask_width,mask_height,rgb);
+    return 0;
+}
+
+
+// The dilate method gives the same shape of border as smearing, but takes
+// the maximum of the weighted taps instead of compositing every one of them.
+// The disc is handled one row offset at a time: the fully weighted middle of
+// each row is a running maximum over a horizontal window, which is built up
+// for each width from the next narrower one, and the few fractionally
+// weighted taps at the rim are taken one by one.  The result is a coverage
+// mask bt+1 pixels larger than the glyph on every side, which is composited
+// once in the border color.
+
+static int dilate_coverage(const unsigned char* buffer, int width, int height, int bt, unsigned char* out) {
+    int mask_width, mask_height, mask_size, i, j, h, u, v, rim, max_h;
+    unsigned weight;
+    float r;
+    unsigned char* windows = NULL;
+    unsigned char* src;
+    unsigned char* dst;
+    unsigned char* prev;
+    unsigned char c;
+    int status = 9999;
+
+    mask_width = width + 2*bt + 2;
+    mask_height = height + 2*bt + 2;
+    mask_size = mask_width * mask_height;
+
+    // windows[h] holds the maximum over a horizontal window of half-width h
+    windows = (unsigned char*)malloc((size_t)(bt+1)*mask_size);
+    if (windows == NULL) {
+        status = 1;
+        goto error;
+    }
+
+    memset(windows,0,mask_size);
+    for (v = 0; v < height; v++) {
+        dst = windows + (v+bt+1) * mask_width + (bt+1);
+        if (buffer == NULL) {
+            memset(dst,255,width);
+        } else {
+            memcpy(dst,buffer+v*width,width);
+        }
+    }
+    for (h = 1; h <= bt; h++) {
+        prev = windows + (h-1) * mask_size;
+        dst = windows + h * mask_size;
+        for (i = 0; i < mask_size; i++) {
+            u = i % mask_width;
+            c = prev[i];
+            if (u > 0 && prev[i-1] > c) {
+                c = prev[i-1];
+            }
+            if (u < mask_width-1 && prev[i+1] > c) {
+                c = prev[i+1];
+            }
+            dst[i] = c;
+        }
+    }
+
+    memset(out,0,mask_size);
+    for (j = -bt-1; j <= bt+1; j++) {
+        if (j*j <= bt*bt) {
+            max_h = (int)sqrt((double)(bt*bt - j*j));
+            src = windows + max_h * mask_size;
+            for (v = MAX(0,j); v < MIN(mask_height,mask_height+j); v++) {
+                dst = out + v * mask_width;
+                prev = src + (v-j) * mask_width;
+                for (u = 0; u < mask_width; u++) {
+                    if (prev[u] > dst[u]) {
+                        dst[u] = prev[u];
+                    }
+                }
+            }
+        } else {
+            max_h = -1;
+        }
+        src = windows;
+        for (rim = max_h+1; rim*rim + j*j < (bt+1)*(bt+1); rim++) {
+            r = sqrt(rim*rim + j*j);
+            weight = float_to_fixed(bt+1-r) / 255;
+            if (weight == 0) {
+                continue;
+            }
+            for (i = -rim; i <= rim; i += 2*rim) {
+                for (v = MAX(0,j); v < MIN(mask_height,mask_height+j); v++) {
+                    dst = out + v * mask_width;
+                    prev = src + (v-j) * mask_width;
+                    for (u = MAX(0,i); u < MIN(mask_width,mask_width+i); u++) {
+                        c = (unsigned char)((prev[u-i] * weight + 127) / 255);
+                        if (c > dst[u]) {
+                            dst[u] = c;
+                        }
+                    }
+                }
+                if (rim == 0) {
+                    break;
+                }
+            }
+        }
+    }
+
+    status = 0;
+
+error:
+    if (windows != NULL) {
+        free(windows);
+    }
+    return status;
+}
+
+
+static size_t hash_outline_key(FTC_FaceID face_id, FT_UInt glyph_index, int font_px, int border_thickness, int border_method) {
+    size_t h = (size_t)face_id;
+    h = h * 31 + glyph_index;
+    h = h * 31 + (size_t)font_px;
+    h = h * 31 + (size_t)border_thickness;
+    h = h * 31 + (size_t)border_method;
+    return h % OUTLINE_CACHE_BUCKETS;
+}
+
+
+static void clear_outline_cache(OutlineCache* cache) {
+    OutlineRecord* rec;
+    OutlineRecord* next;
+    size_t k;
+    if (cache->buckets == NULL) {
+        return;
+    }
+    for (k = 0; k < OUTLINE_CACHE_BUCKETS; k++) {
+        for (rec = cache->buckets[k]; rec != NULL; rec = next) {
+            next = rec->next;
+            free(rec);
+        }
+        cache->buckets[k] = NULL;
+    }
+    cache->n_bytes = 0;
+}
+
+
+static void delete_outline_cache(OutlineCache* cache) {
+    clear_outline_cache(cache);
+    if (cache->buckets != NULL) {
+        free(cache->buckets);
+        cache->buckets = NULL;
+    }
+}
+
+
+// Strokes the glyph's outline with FreeType and renders the outside border
+// to a bitmap.  The glyph comes from the image cache, which is shared, so it
+// is copied before stroking.  Glyphs without an outline (embedded bitmaps,
+// bitmap fonts) can't be stroked; for those *rglyph is left NULL.
+
+static int stroke_glyph(ParlayContext* ctx, const ParlayGlyphPlan* gp, FT_BitmapGlyph* rglyph) {
+    FTC_ScalerRec face_size_info;
+    FT_Glyph glyph;
+    FT_Glyph stroked = NULL;
+    int status = 9999;
+
+    *rglyph = NULL;
+
+    face_size_info.face_id = gp->face_id;
+    face_size_info.width = gp->font_px;
+    face_size_info.height = gp->font_px;
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+
+    if (FTC_ImageCache_LookupScaler(ctx->image_cache,&face_size_info,FT_LOAD_NO_BITMAP,gp->glyph_index,&glyph,NULL)) {
+        status = 1;
+        goto error;
+    }
+    if (glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+        return 0;
+    }
+
+    if (ctx->stroker == NULL) {
+        if (FT_Stroker_New(ctx->library,&ctx->stroker)) {
+            status = 2;
+            goto error;
+        }
+    }
+    FT_Stroker_Set(ctx->stroker,(FT_Fixed)gp->border_thickness*64,FT_STROKER_LINECAP_ROUND,FT_STROKER_LINEJOIN_ROUND,0);
+
+    if (FT_Glyph_Copy(glyph,&stroked)) {
+        status = 3;
+        goto error;
+    }
+    if (FT_Glyph_StrokeBorder(&stroked,ctx->stroker,0,1)) {
+        status = 4;
+        goto error;
+    }
+    if (FT_Glyph_To_Bitmap(&stroked,FT_RENDER_MODE_NORMAL,NULL,1)) {
+        status = 5;
+        goto error;
+    }
+
+    *rglyph = (FT_BitmapGlyph)stroked;
+    stroked = NULL;
+
+    status = 0;
+
+error:
+    if (stroked != NULL) {
+        FT_Done_Glyph(stroked);
+    }
+    return status;
+}
+
+
+// Border masks are cached by glyph, size, thickness, and method.  Subtitles
+// and UI text use a small working set of glyphs, so when the cache outgrows
+// its budget it is simply emptied and refilled.  A stroked border is looked
+// up the same way, but if the glyph can't be stroked *rrec is set to NULL
+// and the caller should smear instead.  The mask is placed relative to the
+// glyph's own bitmap, whose offsets are passed in.
+
+static int get_outline(ParlayContext* ctx, const ParlayGlyphPlan* gp, const unsigned char* buffer, int buffer_left, int buffer_top,
+        OutlineRecord** rrec) {
+    OutlineCache* cache = &ctx->outline_cache;
+    OutlineRecord* rec = NULL;
+    FT_BitmapGlyph stroked = NULL;
+    size_t h, mask_size;
+    int mask_width, mask_height;
+    int j;
+    int status = 9999;
+
+    *rrec = NULL;
+
+    if (cache->buckets == NULL) {
+        cache->buckets = (OutlineRecord**)calloc(OUTLINE_CACHE_BUCKETS,sizeof(OutlineRecord*));
+        if (cache->buckets == NULL) {
+            status = 1;
+            goto error;
+        }
+    }
+
+    h = hash_outline_key(gp->face_id,gp->glyph_index,gp->font_px,gp->border_thickness,gp->border_method);
+    for (rec = cache->buckets[h]; rec != NULL; rec = rec->next) {
+        if (rec->face_id == gp->face_id && rec->glyph_index == gp->glyph_index
+                && rec->font_px == gp->font_px && rec->border_thickness == gp->border_thickness
+                && rec->border_method == gp->border_method) {
+            *rrec = rec;
+            return 0;
+        }
+    }
+
+    if (gp->border_method == PARLAY_BORDER_STROKE) {
+        if (stroke_glyph(ctx,gp,&stroked)) {
+            status = 4;
+            goto error;
+        }
+        if (stroked == NULL) {
+            return 0;
+        }
+        mask_width = stroked->bitmap.width;
+        mask_height = stroked->bitmap.rows;
+    } else {
+        mask_width = gp->width + 2*gp->border_thickness + 2;
+        mask_height = gp->height + 2*gp->border_thickness + 2;
+    }
+    mask_size = (size_t)mask_width * mask_height;
+    if (cache->n_bytes + mask_size > OUTLINE_CACHE_MAX_BYTES) {
+        clear_outline_cache(cache);
+    }
+
+    rec = (OutlineRecord*)malloc(sizeof(OutlineRecord) + mask_size);
+    if (rec == NULL) {
+        status = 2;
+        goto error;
+    }
+    rec->face_id = gp->face_id;
+    rec->glyph_index = gp->glyph_index;
+    rec->font_px = gp->font_px;
+    rec->border_thickness = gp->border_thickness;
+    rec->border_method = gp->border_method;
+    rec->width = mask_width;
+    rec->height = mask_height;
+    rec->buffer = (unsigned char*)&rec[1];
+
+    if (stroked != NULL) {
+        rec->x_offset = stroked->left - buffer_left;
+        rec->y_offset = buffer_top - stroked->top;
+        for (j = 0; j < mask_height; j++) {
+            memcpy(rec->buffer + (size_t)j*mask_width,stroked->bitmap.buffer + j*stroked->bitmap.pitch,mask_width);
+        }
+    } else {
+        rec->x_offset = -gp->border_thickness - 1;
+        rec->y_offset = -gp->border_thickness - 1;
+        if (dilate_coverage(buffer,gp->width,gp->height,gp->border_thickness,rec->buffer)) {
+            status = 3;
+            goto error;
+        }
+    }
+
+    rec->next = cache->buckets[h];
+    cache->buckets[h] = rec;
+    cache->n_bytes += mask_size;
+    *rrec = rec;
+    rec = NULL;
+
+    status = 0;
+
+error:
+    if (stroked != NULL) {
+        FT_Done_Glyph((FT_Glyph)stroked);
+    }
+    if (rec != NULL) {
+        free(rec);
+    }
+    return status;
+}
+
+
+static int dilate_rect(ParlayCanvas* canvas, int x, int y, int width, int height, const float rgb[3], float alpha, int bt) {
+    unsigned char* mask;
+    if (bt == 0 || width <= 0 || height <= 0) {
+        return 0;
+    }
+    mask = (unsigned char*)malloc((size_t)(width+2*bt+2)*(height+2*bt+2));
+    if (mask == NULL) {
+        return 1;
+    }
+    if (dilate_coverage(NULL,width,height,bt,mask)) {
+        free(mask);
+        return 1;
+    }
+    transfer_buffer(canvas,mask,x-bt-1,y-bt-1,width+2*bt+2,height+2*bt+2,rgb,alpha);
+    free(mask);
+    return 0;
+}
+
+
+static int transfer_underline(ParlayCanvas* canvas, ParlayScratch* scratch, const ParlayGlyphPlan* gp, int underline_x, int underline_right, int underline_y, int underline_descender, int smear, float opacity) {
+    int y = -underline_y + underline_descender/2;
+    int width = underline_right - underline_x;
+    int height = MIN((underline_descender+4)/5,1);
+    if (smear) {
+        // A stroked rectangle with round joins is the same shape as a
+        // dilated one, so stroked borders use dilation for underlines
+        if (gp->border_method != PARLAY_BORDER_SMEAR) {
+            return dilate_rect(canvas,underline_x,y,width,height,gp->border_color,gp->border_color[3]*opacity,gp->border_thickness);
+        }
+        return smear_buffer(canvas,scratch,NULL,underline_x,y,width,height,gp->border_color,gp->border_color[3]*opacity,gp->border_thickness);
+    }
+    transfer_rect(canvas,underline_x,y,width,height,gp->text_color,gp->text_color[3]*opacity);
+    return 0;
+}
+
+
+// The work canvas starts out as the background color, or, without one, as
+// whatever is already in the canvas, and is converted back to bytes when
+// everything has been composited into it.
+
+static void fill_canvas(ParlayCanvas* canvas, const float color[4]) {
+    unsigned short fill[4];
+    size_t k, n = (size_t)canvas->width * canvas->height;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        fill[i] = (unsigned short)float_to_fixed(color[i]);
+    }
+    for (k = 0; k < n; k++) {
+        memcpy(canvas->work+k*4,fill,sizeof(fill));
+    }
+}
+
+
+static void load_canvas(ParlayCanvas* canvas) {
+    const unsigned char* src;
+    unsigned short* dst;
+    size_t row_size = (size_t)canvas->width * 4;
+    int j;
+    size_t i;
+
+    for (j = 0; j < canvas->height; j++) {
+        src = canvas->data + j*canvas->pitch;
+        dst = canvas->work + j*row_size;
+        for (i = 0; i < row_size; i++) {
+            dst[i] = (unsigned short)(src[i] * 255);
+        }
+    }
+}
+
+
+// Bytes are truncated, like the old float compositor's.  The row size is in
+// a local so the byte stores can't alias it, which lets the loop vectorize.
+
+static void store_canvas(ParlayCanvas* canvas) {
+    const unsigned short* src;
+    unsigned char* dst;
+    size_t row_size = (size_t)canvas->width * 4;
+    int j;
+    size_t i;
+
+    for (j = 0; j < canvas->height; j++) {
+        src = canvas->work + j*row_size;
+        dst = canvas->data + j*canvas->pitch;
+        for (i = 0; i < row_size; i++) {
+            dst[i] = (unsigned char)(src[i] / 255);
+        }
+    }
+}
+
+
+// Draws the background, highlights, borders, and glyphs of a layout into a
+// canvas, which may be any window onto the layout.  A NULL background color
+// leaves whatever is already in the canvas as the background.  Hidden glyphs
+// are skipped as if they were spaces, and the layout's opacity scales every
+// alpha but the background's.
+
+static int composite_layout(ParlayContext* ctx, ParlayLayout* layout, const float background_color[4], ParlayCanvas* canvas) {
+    ParlayScratch* scratch = &ctx->scratch;
+    float opacity = layout->opacity;
+    int x, y;
+    size_t k, m;
+    ParlayGlyphPlan* gp;
+    FTC_ScalerRec face_size_info;
+    FTC_SBit sbit;
+    FT_BitmapGlyph glyph;
+    const GlyphFileEntry* entry;
+    const unsigned char* c_buffer;
+    int c_left, c_top;
+    OutlineRecord* outline;
+    const ParlayGlyphPlan* underline_end = NULL;
+    int underlining, underline_x = 0, underline_right = 0, underline_y = 0, underline_descender = 0;
+    int status = 9999;
+
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+
+    if (reserve_scratch(&ctx->work,(size_t)canvas->width*canvas->height*4)) {
+        status = 1905;
+        goto error;
+    }
+    canvas->work = ctx->work.data;
+    if (background_color != NULL) {
+        fill_canvas(canvas,background_color);
+    } else {
+        load_canvas(canvas);
+    }
+
+    if (layout->any_highlights) {
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            if (!gp->highlight || gp->hidden) {
+                continue;
+            }
+            y = layout->y_image_offset - (gp->y + gp->ascender);
+            x = gp->x - layout->x_image_offset;
+            transfer_rect(canvas,x,y,gp->advance,gp->line_height,gp->highlight_color,gp->highlight_color[3]*opacity);
+        }
+    }
+
+    for (m = layout->any_borders ? 0 : 1; m < 2; m++) {
+        underlining = 0;
+        for (k = 0; k < layout->n_glyphs; k++) {
+            gp = &layout->glyph_plans[k];
+            if (gp->face_id == NULL || gp->hidden) {
+                continue;
+            }
+            face_size_info.face_id = gp->face_id;
+            face_size_info.width = gp->font_px;
+            face_size_info.height = gp->font_px;
+            // A glyph laid out to be drawn is drawn straight from its bitmap,
+            // which the layout holds on to
+            if (gp->bitmap != NULL) {
+                c_buffer = gp->bitmap;
+                c_left = gp->left;
+                c_top = gp->top;
+            } else if ((entry = find_glyph_file_entry(ctx,gp->face_id,gp->font_px,gp->glyph_index)) != NULL) {
+                c_buffer = entry->bitmap;
+                c_left = entry->rec.left;
+                c_top = entry->rec.top;
+            } else if (gp->is_sbit) {
+                status = FTC_SBitCache_LookupScaler(ctx->sbit_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,&sbit,NULL);
+                if (status) {
+                    status = 1903;
+                    goto error;
+                }
+                c_buffer = sbit->buffer;
+                c_left = sbit->left;
+                c_top = sbit->top;
+            } else {
+                status = FTC_ImageCache_LookupScaler(ctx->image_cache,&face_size_info,FT_LOAD_RENDER,gp->glyph_index,(FT_Glyph*)&glyph,NULL);
+                if (status) {
+                    status = 1903;
+                    goto error;
+                }
+                c_buffer = glyph->bitmap.buffer;
+                c_left = glyph->left;
+                c_top = glyph->top;
+            }
+            y = layout->y_image_offset - (gp->y + gp->top);
+            x = (gp->x + gp->left) - layout->x_image_offset;
+            if (m == 0) {
+                outline = NULL;
+                if (gp->border_thickness != 0 && gp->border_method != PARLAY_BORDER_SMEAR) {
+                    if (get_outline(ctx,gp,c_buffer,c_left,c_top,&outline)) {
+                        status = 1904;
+                        goto error;
+                    }
+                }
+                if (gp->border_thickness == 0) {
+                    // nothing to draw
+                } else if (outline != NULL) {
+                    transfer_buffer(canvas,outline->buffer,x+outline->x_offset,y+outline->y_offset,
+                            outline->width,outline->height,gp->border_color,gp->border_color[3]*opacity);
+                } else if (smear_buffer(canvas,scratch,c_buffer,x,y,gp->width,gp->height,gp->border_color,gp->border_color[3]*opacity,gp->border_thickness)) {
+                    status = 1902;
+                    goto error;
+                }
+            } else {
+                transfer_buffer(canvas,c_buffer,x,y,gp->width,gp->height,gp->text_color,gp->text_color[3]*opacity);
+            }
+            if (underlining) {
+                if (!gp->underline || gp->y != underline_y || gp->line_height-gp->ascender != underline_descender) {
+                    if (transfer_underline(canvas,scratch,underline_end,underline_x,underline_right,underline_y,underline_descender,m==0,opacity)) {
+                        status = 1902;
+                        goto error;
+                    }
+                    if (gp->underline) {
+                        underline_x = gp->x;
+                        underline_right = gp->x + gp->advance;
+                        underline_y = gp->y;
+                        underline_descender = gp->line_height-gp->ascender;
+                    } else {
+                        underlining = 0;
+                    }
+                }
+            } else if (gp->underline) {
+                underlining = 1;
+                underline_x = gp->x;
+                underline_right = gp->x + gp->advance;
+                underline_y = gp->y;
+                underline_descender = gp->line_height-gp->ascender;
+            }
+            // A run of underlining ends under the last underlined glyph, so a
+            // line's underline doesn't depend on whatever comes after it.  On
+            // a line reordered for bidi, the run can grow in either direction.
+            if (gp->underline) {
+                underline_end = gp;
+                if (layout->any_rtl) {
+                    underline_x = MIN(underline_x,gp->x);
+                    underline_right = MAX(underline_right,gp->x + gp->advance);
+                } else {
+                    underline_right = gp->x + gp->advance;
+                }
+            }
+        }
+        if (underlining) {
+            if (transfer_underline(canvas,scratch,underline_end,underline_x,underline_right,underline_y,underline_descender,m==0,opacity)) {
+                status = 1902;
+                goto error;
+            }
+        }
+    }
+
+    store_canvas(canvas);
+    status = 0;
+
+error:
+    return status;
+}
+
+
+static int rasterize(ParlayContext* ctx, ParlayLayout* layout, const float background_color[4], ParlayRGBARawImage* image) {
+    unsigned char* data = NULL;
+    ParlayCanvas canvas;
+    int status = 9999;
+
+    data = malloc((size_t)layout->height * layout->width * 4);
+    if (data == NULL) {
+        status = 1901;
+        goto error;
+    }
+
+    canvas.data = data;
+    canvas.pitch = (size_t)layout->width * 4;
+    canvas.width = layout->width;
+    canvas.height = layout->height;
+    canvas.x_origin = 0;
+    canvas.y_origin = 0;
+    canvas.blend_span = ctx->blend_span;
+
+    status = composite_layout(ctx,layout,background_color,&canvas);
+    if (status) {
+        goto error;
+    }
+
+    image->data = data;
+    image->height = layout->height;
+    image->width = layout->width;
+    image->x0 = layout->x_image_offset;
+    image->y0 = layout->y_image_offset;
+
+    data = NULL;
+
+    status = 0;
+
+error:
+    if (data != NULL) {
+        free(data);
+    }
+    return status;
+}
+
+
+
+static int final_offset(ParlayLayout* layout, ParlayRGBARawImage* image, int fixed_width, int text_alignment) {
+    if (fixed_width != 0) {
+        if (text_alignment == PARLAY_ALIGN_CENTER) {
+            image->x0 += (fixed_width - layout->width) / 2;
+        } else if (text_alignment == PARLAY_ALIGN_RIGHT) {
+            image->x0 += fixed_width - layout->width;
+        }
+    }
+    return 0;
+}
+
+
+
+// Incremental rendering compares a layout's glyph plans with the ones that
+// were last drawn into an image, and redraws only the rectangles around the
+// glyphs that differ.  Two glyph plans draw the same pixels if every field
+// that gets drawn is the same.
+
+static int same_glyph_plan(const ParlayGlyphPlan* a, const ParlayGlyphPlan* b) {
+    if (a->x != b->x || a->y != b->y || a->advance != b->advance || a->line_height != b->line_height
+            || a->ascender != b->ascender || a->face_id != b->face_id || a->hidden != b->hidden
+            || a->highlight != b->highlight || a->underline != b->underline) {
+        return 0;
+    }
+    if (a->highlight && memcmp(a->highlight_color,b->highlight_color,4*sizeof(float))) {
+        return 0;
+    }
+    if (a->face_id != NULL) {
+        if (a->glyph_index != b->glyph_index || a->font_px != b->font_px || a->left != b->left || a->top != b->top
+                || a->width != b->width || a->height != b->height || a->border_thickness != b->border_thickness
+                || memcmp(a->text_color,b->text_color,4*sizeof(float))) {
+            return 0;
+        }
+        if (a->border_thickness != 0 && (a->border_method != b->border_method
+                || memcmp(a->border_color,b->border_color,4*sizeof(float)))) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+// Everything a glyph can draw on, in image pixels.  An underline is drawn
+// for a whole run at once in the colors of the run's last glyph, so an
+// underlined glyph claims the whole width of its line.
+
+static void get_glyph_box(const ParlayLayout* layout, const ParlayGlyphPlan* gp, ParlayRect* box) {
+    int x0, y0, x1, y1, margin;
+
+    x0 = gp->x - layout->x_image_offset;
+    x1 = x0 + gp->advance;
+    y0 = layout->y_image_offset - (gp->y + gp->ascender);
+    y1 = y0 + gp->line_height;
+    if (gp->face_id != NULL) {
+        margin = gp->border_thickness + 2;
+        x0 = MIN(x0,gp->x + gp->left - layout->x_image_offset - margin);
+        x1 = MAX(x1,gp->x + gp->left + gp->width - layout->x_image_offset + margin);
+        y0 = MIN(y0,layout->y_image_offset - (gp->y + gp->top) - margin);
+        y1 = MAX(y1,layout->y_image_offset - (gp->y + gp->top) + gp->height + margin);
+        if (gp->underline) {
+            x0 = MIN(x0,0);
+            x1 = MAX(x1,layout->width);
+            y1 += margin;
+        }
+    }
+    box->x = x0;
+    box->y = y0;
+    box->width = x1 - x0;
+    box->height = y1 - y0;
+}
+
+
+static int rects_overlap(const ParlayRect* a, const ParlayRect* b) {
+    return a->x < b->x + b->width && b->x < a->x + a->width && a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+
+// Adds a glyph box to a list of dirty rectangles, clipped to the image.
+// Overlapping rectangles are merged, so nothing gets drawn twice.
+
+static void add_dirty_rect(ParlayRect* rects, size_t* rn_rects, const ParlayRect* box, int width, int height) {
+    ParlayRect r;
+    int x1, y1;
+    size_t i;
+
+    r.x = MAX(box->x,0);
+    r.y = MAX(box->y,0);
+    x1 = MIN(box->x + box->width,width);
+    y1 = MIN(box->y + box->height,height);
+    if (r.x >= x1 || r.y >= y1) {
+        return;
+    }
+    r.width = x1 - r.x;
+    r.height = y1 - r.y;
+
+    i = 0;
+    while (i < *rn_rects) {
+        if (rects_overlap(&rects[i],&r)) {
+            x1 = MAX(r.x + r.width,rects[i].x + rects[i].width);
+            y1 = MAX(r.y + r.height,rects[i].y + rects[i].height);
+            r.x = MIN(r.x,rects[i].x);
+            r.y = MIN(r.y,rects[i].y);
+            r.width = x1 - r.x;
+            r.height = y1 - r.y;
+            rects[i] = rects[--*rn_rects];
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    rects[(*rn_rects)++] = r;
+}
+
+
+// Redraws one rectangle of a layout's image.  Only the lines with a glyph
+// that can draw inside the rectangle are composited, and whole lines are
+// used so underline runs come out the same as in a full render.
+
+static int redraw_rect(ParlayContext* ctx, ParlayLayout* layout, const float background_color[4],
+        ParlayRGBARawImage* image, const ParlayRect* rect) {
+    ParlayLayout view;
+    ParlayCanvas canvas;
+    ParlayRect box;
+    size_t k, first, last;
+
+    first = layout->n_glyphs;
+    last = 0;
+    for (k = 0; k < layout->n_glyphs; k++) {
+        get_glyph_box(layout,&layout->glyph_plans[k],&box);
+        if (rects_overlap(&box,rect)) {
+            first = MIN(first,k);
+            last = k;
+        }
+    }
+
+    view = *layout;
+    view.n_glyphs = 0;
+    if (first < layout->n_glyphs) {
+        while (first > 0 && layout->glyph_plans[first-1].y == layout->glyph_plans[first].y) {
+            first--;
+        }
+        while (last+1 < layout->n_glyphs && layout->glyph_plans[last+1].y == layout->glyph_plans[last].y) {
+            last++;
+        }
+        view.glyph_plans = layout->glyph_plans + first;
+        view.n_glyphs = last - first + 1;
+    }
+
+    canvas.data = image->data + ((size_t)rect->y*image->width + rect->x)*4;
+    canvas.pitch = image->width*4;
+    canvas.width = rect->width;
+    canvas.height = rect->height;
+    canvas.x_origin = rect->x;
+    canvas.y_origin = rect->y;
+    canvas.blend_span = ctx->blend_span;
+
+    return composite_layout(ctx,&view,background_color,&canvas);
+}
+
+
+// Brings an image of drawn_plans up to date with a layout of the same size
+// and offsets.  The rectangles redrawn are returned if there's room for
+// them, otherwise their bounding box is.
+
+static int update_layout_image(ParlayContext* ctx, ParlayLayout* layout, const ParlayGlyphPlan* drawn_plans, size_t n_drawn,
+        const float background_color[4], ParlayRGBARawImage* image, ParlayRect* rects, size_t max_rects, size_t* rn_rects) {
+    ParlayRect* dirty = NULL;
+    ParlayRect box;
+    size_t k, n_dirty, n_glyphs;
+    int x1, y1;
+    int status = 9999;
+
+    n_glyphs = n_drawn > layout->n_glyphs ? n_drawn : layout->n_glyphs;
+    dirty = (ParlayRect*)malloc((2*n_glyphs+1)*sizeof(ParlayRect));
+    if (dirty == NULL) {
+        status = 2801;
+        goto error;
+    }
+
+    n_dirty = 0;
+    for (k = 0; k < n_glyphs; k++) {
+        if (k < n_drawn && k < layout->n_glyphs && same_glyph_plan(&drawn_plans[k],&layout->glyph_plans[k])) {
+            continue;
+        }
+        if (k < n_drawn) {
+            get_glyph_box(layout,&drawn_plans[k],&box);
+            add_dirty_rect(dirty,&n_dirty,&box,layout->width,layout->height);
+        }
+        if (k < layout->n_glyphs) {
+            get_glyph_box(layout,&layout->glyph_plans[k],&box);
+            add_dirty_rect(dirty,&n_dirty,&box,layout->width,layout->height);
+        }
+    }
+
+    for (k = 0; k < n_dirty; k++) {
+        status = redraw_rect(ctx,layout,background_color,image,&dirty[k]);
+        if (status) {
+            goto error;
+        }
+    }
+
+    if (n_dirty <= max_rects) {
+        memcpy(rects,dirty,n_dirty*sizeof(ParlayRect));
+        *rn_rects = n_dirty;
+    } else if (max_rects > 0) {
+        rects[0] = dirty[0];
+        for (k = 1; k < n_dirty; k++) {
+            x1 = MAX(rects[0].x + rects[0].width,dirty[k].x + dirty[k].width);
+            y1 = MAX(rects[0].y + rects[0].height,dirty[k].y + dirty[k].height);
+            rects[0].x = MIN(rects[0].x,dirty[k].x);
+            rects[0].y = MIN(rects[0].y,dirty[k].y);
+            rects[0].width = x1 - rects[0].x;
+            rects[0].height = y1 - rects[0].y;
+        }
+        *rn_rects = 1;
+    } else {
+        *rn_rects = 0;
+    }
+
+    status = 0;
+
+error:
+    if (dirty != NULL) {
+        free(dirty);
+    }
+    return status;
+}
+
+
+// Remembers what a layout looked like when it was drawn
+
+static int record_drawn_layout(ParlayLayout* layout, const float background_color[4]) {
+    ParlayGlyphPlan* drawn_plans;
+
+    if (layout->n_glyphs > layout->n_drawn_cap) {
+        drawn_plans = (ParlayGlyphPlan*)realloc(layout->drawn_plans,layout->n_glyphs*sizeof(ParlayGlyphPlan));
+        if (drawn_plans == NULL) {
+            layout->drawn = 0;
+            return 1;
+        }
+        layout->drawn_plans = drawn_plans;
+        layout->n_drawn_cap = layout->n_glyphs;
+    }
+    memcpy(layout->drawn_plans,layout->glyph_plans,layout->n_glyphs*sizeof(ParlayGlyphPlan));
+    layout->n_drawn = layout->n_glyphs;
+    layout->drawn_opacity = layout->opacity;
+    memcpy(layout->drawn_background_color,background_color,4*sizeof(float));
+    layout->drawn = 1;
+    return 0;
+}
+
+
+//---------------------------------------------------------------------
+// Section 4: Atlas packing functions
+
+// Atlas pages are packed with a skyline: a list of segments spanning the page
+// width, each recording how far down the page is used over that stretch.  A
+// rectangle goes wherever its bottom edge ends up highest, resting on the
+// tallest segment it covers.  Space under an overhang is never reclaimed,
+// which wastes a little but is fast and suits rows of similar-height text.
+
+static int new_atlas_page(ParlayAtlas* atlas) {
+    AtlasPage* pages;
+    AtlasPage* page;
+    size_t cap;
+
+    if (atlas->n_pages == atlas->pages_cap) {
+        cap = atlas->pages_cap ? atlas->pages_cap*2 : 4;
+        pages = (AtlasPage*)realloc(atlas->pages,cap*sizeof(AtlasPage));
+        if (pages == NULL) {
+            return 1;
+        }
+        atlas->pages = pages;
+        atlas->pages_cap = cap;
+    }
+    page = &atlas->pages[atlas->n_pages];
+    page->data = (unsigned char*)calloc((size_t)atlas->page_width*atlas->page_height,4);
+    page->skyline = (SkylineSegment*)malloc(16*sizeof(SkylineSegment));
+    if (page->data == NULL || page->skyline == NULL) {
+        free(page->data);
+        free(page->skyline);
+        return 1;
+    }
+    page->skyline[0].x = 0;
+    page->skyline[0].y = 0;
+    page->skyline[0].width = atlas->page_width;
+    page->n_segments = 1;
+    page->segments_cap = 16;
+    atlas->n_pages++;
+    return 0;
+}
+
+
+// Returns nonzero if a width x height rectangle fits with its left edge at
+// segment i, and the y it would sit at
+
+static int skyline_fit(const ParlayAtlas* atlas, const AtlasPage* page, size_t i, int width, int height, int* ry) {
+    int remaining = width;
+    int y = 0;
+    size_t j = i;
+
+    if (page->skyline[i].x + width > atlas->page_width) {
+        return 0;
+    }
+    while (remaining > 0) {
+        y = MAX(y,page->skyline[j].y);
+        if (y + height > atlas->page_height) {
+            return 0;
+        }
+        remaining -= page->skyline[j].width;
+        j++;
+    }
+    *ry = y;
+    return 1;
+}
+
+
+static int skyline_insert(AtlasPage* page, size_t i, int width, int height, int y) {
+    SkylineSegment* segments;
+    SkylineSegment* seg;
+    size_t j, cap;
+    int right, shrink;
+
+    if (page->n_segments == page->segments_cap) {
+        cap = page->segments_cap*2;
+        segments = (SkylineSegment*)realloc(page->skyline,cap*sizeof(SkylineSegment));
+        if (segments == NULL) {
+            return 1;
+        }
+        page->skyline = segments;
+        page->segments_cap = cap;
+    }
+
+    memmove(&page->skyline[i+1],&page->skyline[i],(page->n_segments-i)*sizeof(SkylineSegment));
+    page->n_segments++;
+    seg = &page->skyline[i];
+    seg->y = y + height;
+    seg->width = width;
+    right = seg->x + width;
+
+    // trim or drop the segments the new one covers
+
+    j = i+1;
+    while (j < page->n_segments && page->skyline[j].x < right) {
+        shrink = right - page->skyline[j].x;
+        if (page->skyline[j].width <= shrink) {
+            memmove(&page->skyline[j],&page->skyline[j+1],(page->n_segments-j-1)*sizeof(SkylineSegment));
+            page->n_segments--;
+        } else {
+            page->skyline[j].x += shrink;
+            page->skyline[j].width -= shrink;
+            break;
+        }
+    }
+
+    // merge neighbors at the same height
+
+    j = 0;
+    while (j+1 < page->n_segments) {
+        if (page->skyline[j].y == page->skyline[j+1].y) {
+            page->skyline[j].width += page->skyline[j+1].width;
+            memmove(&page->skyline[j+1],&page->skyline[j+2],(page->n_segments-j-2)*sizeof(SkylineSegment));
+            page->n_segments--;
+        } else {
+            j++;
+        }
+    }
+    return 0;
+}
+
+
+// Finds room for a rectangle in the first page that has it, adding a page if
+// none does
+
+static int place_in_atlas(ParlayAtlas* atlas, int width, int height, int* rpage, int* rx, int* ry) {
+    AtlasPage* page;
+    size_t p, i, best_i = 0;
+    int y, best_y = 0, best_bottom;
+    int padded_width = width + atlas->padding;
+    int padded_height = height + atlas->padding;
+
+    if (width > atlas->page_width || height > atlas->page_height) {
+        return 2201;
+    }
+    padded_width = MIN(padded_width,atlas->page_width);
+    padded_height = MIN(padded_height,atlas->page_height);
+
+    for (p = 0; ; p++) {
+        if (p == atlas->n_pages) {
+            if (new_atlas_page(atlas)) {
+                return 2202;
+            }
+        }
+        page = &atlas->pages[p];
+        best_bottom = INT_MAX;
+        for (i = 0; i < page->n_segments; i++) {
+            if (skyline_fit(atlas,page,i,padded_width,padded_height,&y) && y + padded_height < best_bottom) {
+                best_bottom = y + padded_height;
+                best_i = i;
+                best_y = y;
+            }
+        }
+        if (best_bottom != INT_MAX) {
+            break;
+        }
+    }
+
+    *rx = page->skyline[best_i].x;
+    *ry = best_y;
+    *rpage = (int)p;
+    if (skyline_insert(page,best_i,padded_width,padded_height,best_y)) {
+        return 2203;
+    }
+    return 0;
+}
+
+
+// Rasterizes a finished layout into a free spot in the atlas
+
+static int add_layout_to_atlas(ParlayContext* ctx, ParlayAtlas* atlas, ParlayLayout* layout, const ParlayControl* ctl,
+        ParlayAtlasEntry* entry) {
+    ParlayCanvas canvas;
+    ParlayRGBARawImage offsets;
+    int page, x, y;
+    int status = 9999;
+
+    offsets.data = NULL;
+    offsets.width = layout->width;
+    offsets.height = layout->height;
+    offsets.x0 = layout->x_image_offset;
+    offsets.y0 = layout->y_image_offset;
+    final_offset(layout,&offsets,ctl->width,layout->text_alignment);
+
+    if (layout->width <= 0 || layout->height <= 0) {
+        page = -1;
+        x = 0;
+        y = 0;
+    } else {
+        status = place_in_atlas(atlas,layout->width,layout->height,&page,&x,&y);
+        if (status) {
+            goto error;
+        }
+        canvas.pitch = (size_t)atlas->page_width * 4;
+        canvas.data = atlas->pages[page].data + y*canvas.pitch + x*4;
+        canvas.width = layout->width;
+        canvas.height = layout->height;
+        canvas.x_origin = 0;
+        canvas.y_origin = 0;
+        canvas.blend_span = ctx->blend_span;
+        status = composite_layout(ctx,layout,ctl->background_color,&canvas);
+        if (status) {
+            goto error;
+        }
+    }
+
+    entry->page = page;
+    entry->x = x;
+    entry->y = y;
+    entry->width = layout->width;
+    entry->height = layout->height;
+    entry->u0 = (float)x / atlas->page_width;
+    entry->v0 = (float)y / atlas->page_height;
+    entry->u1 = (float)(x + layout->width) / atlas->page_width;
+    entry->v1 = (float)(y + layout->height) / atlas->page_height;
+    entry->x0 = offsets.x0;
+    entry->y0 = offsets.y0;
+
+    status = 0;
+
+error:
+    return status;
+}
+
+
+
+
+//---------------------------------------------------------------------
+// Section 5: Paragraph builder functions
+
+// A builder's layout is never finalized.  Its image is always the wrap width
+// wide and cropped naturally, with the top of the first line at row 0, so
+// finished lines never move once they're drawn.  Only the last line is still
+// open; to render, it's laid out provisionally and put back afterwards, so
+// that more text can still be added to it.
+
+static __inline int line_top_row(const ParlayGlyphPlan* gp) {
+    return -(gp->y + gp->ascender);
+}
+
+static __inline int line_bottom_row(const ParlayGlyphPlan* gp) {
+    return -(gp->y + gp->ascender - gp->line_height);
+}
+
+
+// The highest row a glyph can draw on, allowing for borders and underlines
+
+static int glyph_top_row(const ParlayGlyphPlan* gp) {
+    int row = line_top_row(gp);
+    if (gp->face_id != NULL) {
+        row = MIN(row,-(gp->y + gp->top) - gp->border_thickness - 2);
+    }
+    return row;
+}
+
+
+// How far below its line a glyph can draw
+
+static int glyph_overhang(const ParlayGlyphPlan* gp) {
+    int overhang = gp->border_thickness + 2;
+    if (gp->face_id != NULL) {
+        overhang = MAX(overhang,-(gp->y + gp->top) + gp->height + gp->border_thickness + 2 - line_bottom_row(gp));
+    }
+    return overhang;
+}
+
+
+static int lay_out_open_line(ParlayParagraphBuilder* builder) {
+    ParlayLayout* layout = builder->layout;
+    SavedGlyphPosition* saved;
+    size_t k, first = layout->first_glyph_of_current_line, n = layout->n_glyphs;
+
+    if (n - first > builder->saved_cap) {
+        saved = (SavedGlyphPosition*)realloc(builder->saved,(n-first)*2*sizeof(SavedGlyphPosition));
+        if (saved == NULL) {
+            return 1;
+        }
+        builder->saved = saved;
+        builder->saved_cap = (n-first)*2;
+    }
+    for (k = first; k < n; k++) {
+        builder->saved[k-first].x = layout->glyph_plans[k].x;
+        builder->saved[k-first].line_height = layout->glyph_plans[k].line_height;
+        builder->saved[k-first].ascender = layout->glyph_plans[k].ascender;
+    }
+    if (first < n) {
+        lay_out_line(layout,0,0);
+    }
+    return 0;
+}
+
+
+static void restore_open_line(ParlayParagraphBuilder* builder, size_t first, size_t first_word, int line_y_top, int glyph_x) {
+    ParlayLayout* layout = builder->layout;
+    size_t k;
+
+    for (k = first; k < layout->n_glyphs; k++) {
+        layout->glyph_plans[k].x = builder->saved[k-first].x;
+        layout->glyph_plans[k].line_height = builder->saved[k-first].line_height;
+        layout->glyph_plans[k].ascender = builder->saved[k-first].ascender;
+    }
+    layout->first_glyph_of_current_line = first;
+    layout->first_glyph_of_current_word = first_word;
+    layout->line_y_top = line_y_top;
+    layout->glyph_x = glyph_x;
+}
+
+
+// Brings the builder's image up to date.  Everything from the top of what
+// the open line drew last time, or the top of anything drawn since, down to
+// the bottom is cleared and redrawn, along with any earlier line that could
+// reach into it.
+
+static int render_builder(ParlayParagraphBuilder* builder, int* rdirty_y, int* rdirty_height) {
+    ParlayLayout* layout = builder->layout;
+    ParlayLayout view;
+    ParlayCanvas canvas;
+    ParlayGlyphPlan* gp;
+    unsigned char* data;
+    size_t pitch = (size_t)layout->width * 4;
+    size_t k, n, first_open, first_word, first_drawn;
+    int line_y_top, glyph_x, height, band_top, rows_cap, line_y;
+    int status = 9999;
+
+    n = layout->n_glyphs;
+    first_open = layout->first_glyph_of_current_line;
+    first_word = layout->first_glyph_of_current_word;
+    line_y_top = layout->line_y_top;
+    glyph_x = layout->glyph_x;
+
+    *rdirty_y = 0;
+    *rdirty_height = 0;
+    if (n == builder->n_rendered) {
+        return 0;
+    }
+
+    // Lines that were finished since the last render are final
+    if (reorder_lines(layout->ctx,layout,builder->n_aligned,first_open)) {
+        return 2713;
+    }
+    realign_lines(layout,builder->n_aligned,first_open,builder->text_alignment);
+    builder->n_aligned = first_open;
+
+    if (lay_out_open_line(builder)) {
+        return 2711;
+    }
+    if (reorder_lines(layout->ctx,layout,first_open,n)) {
+        status = 2714;
+        goto error;
+    }
+    realign_lines(layout,first_open,n,builder->text_alignment);
+
+    height = n > 0 ? line_bottom_row(&layout->glyph_plans[n-1]) : 0;
+
+    band_top = MIN(builder->stale_row,builder->height);
+    for (k = builder->first_dirty_glyph; k < n; k++) {
+        gp = &layout->glyph_plans[k];
+        band_top = MIN(band_top,glyph_top_row(gp));
+        builder->max_overhang = MAX(builder->max_overhang,glyph_overhang(gp));
+    }
+    band_top = MAX(band_top,0);
+
+    if (height > builder->rows_cap) {
+        rows_cap = MAX(height,builder->rows_cap*2);
+        data = (unsigned char*)realloc(builder->data,(size_t)rows_cap*pitch);
+        if (data == NULL) {
+            status = 2712;
+            goto error;
+        }
+        builder->data = data;
+        builder->rows_cap = rows_cap;
+    }
+
+    if (band_top < height) {
+        first_drawn = builder->first_dirty_glyph;
+        while (first_drawn > 0) {
+            gp = &layout->glyph_plans[first_drawn-1];
+            if (line_bottom_row(gp) + builder->max_overhang < band_top) {
+                break;
+            }
+            line_y = gp->y;
+            while (first_drawn > 0 && layout->glyph_plans[first_drawn-1].y == line_y) {
+                first_drawn--;
+            }
+        }
+
+        view = *layout;
+        view.glyph_plans = layout->glyph_plans + first_drawn;
+        view.n_glyphs = n - first_drawn;
+        view.height = height;
+
+        canvas.data = builder->data + (size_t)band_top*pitch;
+        canvas.pitch = pitch;
+        canvas.width = layout->width;
+        canvas.height = height - band_top;
+        canvas.x_origin = 0;
+        canvas.y_origin = band_top;
+        canvas.blend_span = layout->ctx->blend_span;
+
+        status = composite_layout(layout->ctx,&view,builder->background_color,&canvas);
+        if (status) {
+            goto error;
+        }
+
+        *rdirty_y = band_top;
+        *rdirty_height = height - band_top;
+    }
+
+    builder->stale_row = INT_MAX;
+    for (k = first_open; k < n; k++) {
+        builder->stale_row = MIN(builder->stale_row,glyph_top_row(&layout->glyph_plans[k]));
+    }
+    builder->first_dirty_glyph = first_open;
+    builder->n_rendered = n;
+    builder->height = height;
+
+    status = 0;
+
+error:
+    restore_open_line(builder,first_open,first_word,line_y_top,glyph_x);
+    return status;
+}
+
+
+
+
+//---------------------------------------------------------------------
+// Paragraph functions
+
+// The default context backs the original context-free API
+
+static ParlayContext* default_context;
+
+
+int parlay_context_new(unsigned max_faces, unsigned max_sizes, unsigned long max_bytes, ParlayContext** rctx) {
+    ParlayContext* ctx = NULL;
+    int status = 9999;
+
+    ctx = (ParlayContext*)calloc(1,sizeof(ParlayContext));
+    if (ctx == NULL) {
+        status = 6;
+        goto error;
+    }
+    ctx->max_faces = max_faces;
+    ctx->max_sizes = max_sizes;
+    ctx->max_bytes = max_bytes;
+    ctx->blend_span = select_blend_span();
+    ctx->ascii_span = select_ascii_span();
+    ctx->check_utf8 = select_check_utf8();
+    if (FT_Init_FreeType(&ctx->library)) {
+        status = 1;
+        goto error;
+    }
+    if (FTC_Manager_New(ctx->library,max_faces,max_sizes,max_bytes,load_face_callback,NULL,&ctx->manager)) {
+        status = 2;
+        goto error;
+    }
+    if (FTC_CMapCache_New(ctx->manager,&ctx->cmap_cache)) {
+        status = 3;
+        goto error;
+    }
+    if (FTC_SBitCache_New(ctx->manager,&ctx->sbit_cache)) {
+        status = 4;
+        goto error;
+    }
+    if (FTC_ImageCache_New(ctx->manager,&ctx->image_cache)) {
+        status = 5;
+        goto error;
+    }
+
+    *rctx = ctx;
+    ctx = NULL;
+
+    status = 0;
+
+error:
+    if (ctx != NULL) {
+        parlay_context_delete(ctx);
+    }
+    return status;
+}
+
+
+// A clone gets its own FreeType library and caches, with the same cache limits
+// and registered fonts as the original, sharing any font data in memory.
+// This is how to get one context per thread without registering every font
+// again.
+
+int parlay_context_clone(const ParlayContext* src, ParlayContext** rctx) {
+    ParlayContext* ctx = NULL;
+    FontRecord* font_rec;
+    size_t k;
+    int status = 9999;
+
+    status = parlay_context_new(src->max_faces,src->max_sizes,src->max_bytes,&ctx);
+    if (status) {
+        goto error;
+    }
+    // Fonts are registered in handle order, so every handle means the same
+    // font in the clone, and fallbacks can be copied as they are
+    for (k = 0; k < src->n_fonts; k++) {
+        font_rec = src->fonts[k];
+        if (add_font_record(ctx,font_rec->name,font_rec->faces)) {
+            status = 7;
+            goto error;
+        }
+        if (!font_rec->registered) {
+            parlay_context_unregister_font(ctx,font_rec->name);
+        }
+        if (font_rec->n_fallbacks != 0) {
+            ctx->fonts[k]->fallbacks = (ParlayFontHandle*)malloc(font_rec->n_fallbacks*sizeof(ParlayFontHandle));
+            if (ctx->fonts[k]->fallbacks == NULL) {
+                status = 8;
+                goto error;
+            }
+            memcpy(ctx->fonts[k]->fallbacks,font_rec->fallbacks,font_rec->n_fallbacks*sizeof(ParlayFontHandle));
+            ctx->fonts[k]->n_fallbacks = font_rec->n_fallbacks;
+        }
+    }
+
+    *rctx = ctx;
+    ctx = NULL;
+
+    status = 0;
+
+error:
+    if (ctx != NULL) {
+        parlay_context_delete(ctx);
+    }
+    return status;
+}
+
+
+int parlay_context_delete(ParlayContext* ctx) {
+    FontRecord* font_rec;
+    FontRecord* next;
+    size_t k;
+    int status = 0;
+    if (ctx->stroker != NULL) {
+        FT_Stroker_Done(ctx->stroker);
+    }
+    if (ctx->manager != NULL) {
+        FTC_Manager_Done(ctx->manager);
+    }
+    if (ctx->library != NULL) {
+        if (FT_Done_FreeType(ctx->library)) {
+            status = 9;
+        }
+    }
+    discard_batch_workers(ctx);
+    delete_outline_cache(&ctx->outline_cache);
+    delete_metrics_cache(&ctx->metrics_cache);
+    delete_kerning_cache(&ctx->kerning_cache);
+    delete_glyph_cache(&ctx->glyph_cache);
+    if (ctx->glyph_file != NULL) {
+        delete_glyph_file(ctx->glyph_file);
+    }
+    if (ctx->scratch.data != NULL) {
+        free(ctx->scratch.data);
+    }
+    if (ctx->work.data != NULL) {
+        free(ctx->work.data);
+    }
+    for (k = 0; k < ctx->n_fonts; k++) {
+        free_font_record(ctx->fonts[k]);
+    }
+    for (font_rec = ctx->retired_fonts; font_rec != NULL; font_rec = next) {
+        next = font_rec->next;
+        free_font_record(font_rec);
+    }
+    if (ctx->fonts != NULL) {
+        free(ctx->fonts);
+    }
+    if (ctx->font_buckets != NULL) {
+        free(ctx->font_buckets);
+    }
+    free(ctx);
+    return status;
+}
+
+
+int parlay_init(void) {
+    if (default_context == NULL) {
+        return parlay_context_new(0,0,0,&default_context);
+    }
+    return 0;
+}
+
+
+// Like parlay_init, but with limits for the default context's FreeType
+// caches, as for parlay_context_new.  The limits only take if the default
+// context doesn't exist yet.
+
+int parlay_init_with_limits(unsigned max_faces, unsigned max_sizes, unsigned long max_bytes) {
+    if (default_context == NULL) {
+        return parlay_context_new(max_faces,max_sizes,max_bytes,&default_context);
+    }
+    return 0;
+}
+
+
+int parlay_finalize(void) {
+    int status;
+    if (default_context != NULL) {
+        status = parlay_context_delete(default_context);
+        default_context = NULL;
+        return status;
+    }
+    return 0;
+}
+
+
+int parlay_register_font(const char* font_name, const char* normal_filename, const char* italic_filename,
+        const char* bold_filename, const char* bold_italic_filename) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_register_font(default_context,font_name,normal_filename,italic_filename,
+            bold_filename,bold_italic_filename);
+}
+
+
+int parlay_register_font_memory(const char* font_name, const void* normal_data, size_t normal_size,
+        const void* italic_data, size_t italic_size, const void* bold_data, size_t bold_size,
+        const void* bold_italic_data, size_t bold_italic_size) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_register_font_memory(default_context,font_name,normal_data,normal_size,italic_data,italic_size,
+            bold_data,bold_size,bold_italic_data,bold_italic_size);
+}
+
+
+int parlay_register_mapped_font(const char* font_name, const char* normal_filename, const char* italic_filename,
+        const char* bold_filename, const char* bold_italic_filename) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_register_mapped_font(default_context,font_name,normal_filename,italic_filename,
+            bold_filename,bold_italic_filename);
+}
+
+
+int parlay_unregister_font(const char* font_name) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_unregister_font(default_context,font_name);
+}
+
+
+int parlay_get_font_handle(const char* font_name, ParlayFontHandle* rfont_handle) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_get_font_handle(default_context,font_name,rfont_handle);
+}
+
+
+int parlay_set_font_fallbacks(const char* font_name, const char* const* fallback_names, int n_fallbacks) {
+    if (default_context == NULL) {
+        return 302;
+    }
+    return parlay_context_set_font_fallbacks(default_context,font_name,fallback_names,n_fallbacks);
+}
+
+
+// Lays out plain text into an empty layout, ready to be rasterized
+
+static int lay_out_plain_text(ParlayContext* ctx, ParlayLayout* layout, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl) {
+    int status = 9999;
+
+    layout->kerning = ctl->kerning == PARLAY_KERNING_ON;
+    layout->line_breaking = ctl->line_breaking == PARLAY_BREAK_OPTIMAL ? PARLAY_BREAK_OPTIMAL : PARLAY_BREAK_GREEDY;
+    status = add_text_to_layout(ctx,layout,&text,style,ctl->width,ctl->collapse_whitespace,SIZE_MAX);
+    if (status) {
+        goto error;
+    }
+
+    status = finalize_layout(ctx,layout,ctl->cropping_strategy,ctl->width);
+    if (status) {
+        goto error;
+    }
+    layout->fixed_width = ctl->width;
+
+    status = realign(layout,ctl->text_alignment);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    return status;
+}
+
+
+static int render_layout(ParlayContext* ctx, ParlayLayout* layout, const float background_color[4], ParlayRGBARawImage* image) {
+    int status = 9999;
+
+    status = rasterize(ctx,layout,background_color,image);
+    if (status) {
+        goto error;
+    }
+
+    status = final_offset(layout,image,layout->fixed_width,layout->text_alignment);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    return status;
+}
+
+
+// Composites a finished layout straight into caller memory.  The canvas is
+// the part of the layout that lands inside the target, so nothing outside
+// the paragraph's own rectangle is touched.
+
+static int render_layout_to_target(ParlayContext* ctx, ParlayLayout* layout, const float background_color[4],
+        const ParlayRGBATarget* target, ParlayRGBARawImage* image) {
+    ParlayCanvas canvas;
+    int x_min, y_min, x_max, y_max;
+    int status = 9999;
+
+    if (target->data == NULL || target->width < 0 || target->height < 0
+            || target->pitch < (size_t)target->width * 4) {
+        status = 2401;
+        goto error;
+    }
+
+    x_min = MAX(0,-target->x);
+    y_min = MAX(0,-target->y);
+    x_max = MIN(layout->width,target->width-target->x);
+    y_max = MIN(layout->height,target->height-target->y);
+
+    if (x_min < x_max && y_min < y_max) {
+        canvas.data = target->data + (size_t)(target->y+y_min)*target->pitch + (size_t)(target->x+x_min)*4;
+        canvas.pitch = target->pitch;
+        canvas.width = x_max - x_min;
+        canvas.height = y_max - y_min;
+        canvas.x_origin = x_min;
+        canvas.y_origin = y_min;
+        canvas.blend_span = ctx->blend_span;
+        status = composite_layout(ctx,layout,target->clear_background ? background_color : NULL,&canvas);
+        if (status) {
+            goto error;
+        }
+    }
+
+    image->data = NULL;
+    image->width = layout->width;
+    image->height = layout->height;
+    image->x0 = layout->x_image_offset;
+    image->y0 = layout->y_image_offset;
+
+    status = final_offset(layout,image,layout->fixed_width,layout->text_alignment);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    return status;
+}
+
+
+// Fills in the metrics of a finished layout.  A line is a run of glyphs on
+// the same baseline, the same way realign sees it, so lines with no glyphs
+// at all (from consecutive line breaks) aren't listed.
+
+static int measure_layout(ParlayLayout* layout, const ParlayControl* ctl, ParlayTextMetrics* metrics) {
+    ParlayRGBARawImage offsets;
+    ParlayLineExtent* line;
+    ParlayGlyphPlan* gp;
+    size_t i, n_lines;
+    int status = 9999;
+
+    metrics->lines = NULL;
+    metrics->n_lines = 0;
+
+    offsets.data = NULL;
+    offsets.x0 = layout->x_image_offset;
+    offsets.y0 = layout->y_image_offset;
+    final_offset(layout,&offsets,ctl->width,layout->text_alignment);
+
+    n_lines = 0;
+    for (i = 0; i < layout->n_glyphs; i++) {
+        if (i == 0 || layout->glyph_plans[i].y != layout->glyph_plans[i-1].y) {
+            n_lines++;
+        }
+    }
+
+    if (n_lines > 0) {
+        metrics->lines = (ParlayLineExtent*)malloc(n_lines*sizeof(ParlayLineExtent));
+        if (metrics->lines == NULL) {
+            status = 2501;
+            goto error;
+        }
+    }
+
+    line = NULL;
+    for (i = 0; i < layout->n_glyphs; i++) {
+        gp = &layout->glyph_plans[i];
+        if (i == 0 || gp->y != layout->glyph_plans[i-1].y) {
+            line = &metrics->lines[metrics->n_lines++];
+            line->x = gp->x - layout->x_image_offset;
+            line->width = gp->advance;
+            line->baseline = layout->y_image_offset - gp->y;
+            line->y = line->baseline - gp->ascender;
+            line->height = gp->line_height;
+        } else {
+            // a line reordered for bidi doesn't start with its first glyph
+            if (gp->x - layout->x_image_offset < line->x) {
+                line->width += line->x - (gp->x - layout->x_image_offset);
+                line->x = gp->x - layout->x_image_offset;
+            }
+            line->width = MAX(line->width,gp->x + gp->advance - layout->x_image_offset - line->x);
+        }
+    }
+
+    // tight cropping of a paragraph with no ink can leave a negative extent
+    metrics->width = layout->width > 0 ? layout->width : 0;
+    metrics->height = layout->height > 0 ? layout->height : 0;
+    metrics->x0 = offsets.x0;
+    metrics->y0 = offsets.y0;
+
+    status = 0;
+
+error:
+    return status;
+}
+
+
+static int render_plain_text(ParlayContext* ctx, ParlayLayout* layout, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    int status = 9999;
+
+    status = lay_out_plain_text(ctx,layout,text,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = render_layout(ctx,layout,ctl->background_color,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    return status;
+}
+
+
+int parlay_context_plain_text(ParlayContext* ctx, const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(text),&layout);
+    if (status) {
+        goto error;
+    }
+
+    status = render_plain_text(ctx,layout,text,style,ctl,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_plain_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_plain_text(default_context,text,style,ctl,image);
+}
+
+
+// Renders the glyphs for ranges of characters into FreeType's caches ahead
+// of time, during a loading screen say, so that the first text to use them
+// doesn't stall.  The font, style, and size come from the style, the same
+// way they do when laying out text; characters the font doesn't have come
+// from its fallbacks, and ones that none of them have are skipped.  Glyphs
+// only stay cached while they fit the context's cache limits, so the limits
+// need to be big enough to hold everything preloaded.  Borders aren't
+// prepared.
+
+int parlay_context_preload_glyphs(ParlayContext* ctx, const ParlayStyle* style, const ParlayCodepointRange* ranges,
+        size_t n_ranges) {
+    const FontRecord* font_rec;
+    FTC_FaceID face_id;
+    FT_Face face;
+    FT_Size size;
+    FTC_ScalerRec face_size_info;
+    FTC_ScalerRec fallback_size_info;
+    MetricsRecord rec;
+    FT_UInt glyph_index;
+    unsigned long c, last;
+    size_t i;
+    int status = 9999;
+
+    if (style->font_name == NULL) {
+        font_rec = lookup_font_handle(ctx,style->font_handle);
+    } else {
+        font_rec = lookup_font_record(ctx,style->font_name);
+    }
+    face_id = font_rec != NULL ? get_style_face_id(font_rec,style->font_style) : NULL;
+    if (face_id == NULL) {
+        status = 3002;
+        goto error;
+    }
+    if (FTC_Manager_LookupFace(ctx->manager,face_id,&face)) {
+        status = 3003;
+        goto error;
+    }
+
+    face_size_info.face_id = face_id;
+    face_size_info.width = (int)ceil(style->font_size * style->font_scaler);
+    face_size_info.height = face_size_info.width;
+    face_size_info.pixel = 1;
+    face_size_info.x_res = 0;
+    face_size_info.y_res = 0;
+    if (FTC_Manager_LookupSize(ctx->manager,&face_size_info,&size)) {
+        status = 3004;
+        goto error;
+    }
+
+    for (i = 0; i < n_ranges; i++) {
+        // Not MIN, which would take a last past INT_MAX as negative
+        last = ranges[i].last > 0x10FFFF ? 0x10FFFF : ranges[i].last;
+        for (c = ranges[i].first; c <= last; c++) {
+            glyph_index = FTC_CMapCache_Lookup(ctx->cmap_cache,face_id,0,(FT_UInt32)c);
+            if (glyph_index != 0) {
+                status = get_rendered_glyph_record(ctx,&face_size_info,glyph_index,&rec,NULL,NULL);
+            } else {
+                fallback_size_info = face_size_info;
+                glyph_index = get_fallback_glyph(ctx,font_rec,style->font_style,(codepoint_t)c,
+                        &fallback_size_info.face_id);
+                if (glyph_index == 0) {
+                    continue;
+                }
+                status = get_rendered_glyph_record(ctx,&fallback_size_info,glyph_index,&rec,NULL,NULL);
+            }
+            if (status) {
+                status = 3005;
+                goto error;
+            }
+        }
+    }
+
+    status = 0;
+
+error:
+    return status;
+}
+
+
+int parlay_preload_glyphs(const ParlayStyle* style, const ParlayCodepointRange* ranges, size_t n_ranges) {
+    if (default_context == NULL) {
+        return 3001;
+    }
+    return parlay_context_preload_glyphs(default_context,style,ranges,n_ranges);
+}
+
+
+// Opens a glyph file as the context's persistent glyph cache.  Glyphs in it
+// are laid out and drawn without FreeType rendering them, and glyphs that do
+// get rendered are added to it, to be written out by
+// parlay_context_save_glyph_cache.  If the file doesn't exist yet, or can't
+// be used, the cache starts out empty and the file is written from scratch.
+// Only this context uses the file, not its clones.
+
+int parlay_context_open_glyph_cache(ParlayContext* ctx, const char* filename) {
+    GlyphFile* file = NULL;
+    int status = 9999;
+
+    if (ctx->glyph_file != NULL) {
+        status = 3101;
+        goto error;
+    }
+    file = (GlyphFile*)calloc(1,sizeof(GlyphFile) + strlen(filename) + 1);
+    if (file == NULL) {
+        status = 3102;
+        goto error;
+    }
+    strcpy((char*)&file[1],filename);
+    file->filename = (const char*)&file[1];
+    file->buckets = (GlyphFileEntry**)calloc(GLYPH_FILE_BUCKETS,sizeof(GlyphFileEntry*));
+    if (file->buckets == NULL) {
+        status = 3102;
+        goto error;
+    }
+    if (read_glyph_file(ctx->library,file)) {
+        status = 3102;
+        goto error;
+    }
+    ctx->glyph_file = file;
+    file = NULL;
+
+    status = 0;
+
+error:
+    if (file != NULL) {
+        delete_glyph_file(file);
+    }
+    return status;
+}
+
+
+// Writes the glyphs rendered since the glyph file was opened or last saved
+// to the end of it, or writes the whole file if it has to be written from
+// scratch.
+
+int parlay_context_save_glyph_cache(ParlayContext* ctx) {
+    static const unsigned char padding[8] = { 0 };
+    GlyphFile* file = ctx->glyph_file;
+    GlyphFileHeader header;
+    GlyphFileEntry* entry;
+    FT_Int major, minor, patch;
+    FILE* f = NULL;
+    size_t k, n_bitmap;
+    int status = 9999;
+
+    if (file == NULL) {
+        status = 3111;
+        goto error;
+    }
+    f = fopen(file->filename,file->rewrite ? "wb" : "ab");
+    if (f == NULL) {
+        status = 3112;
+        goto error;
+    }
+    if (file->rewrite) {
+        FT_Library_Version(ctx->library,&major,&minor,&patch);
+        memset(&header,0,sizeof(header));
+        memcpy(header.magic,"PARLAYGF",8);
+        header.version = GLYPH_FILE_VERSION;
+        header.freetype_version = (uint32_t)(major << 16 | minor << 8 | patch);
+        header.byte_order = 0x01020304;
+        if (fwrite(&header,sizeof(header),1,f) != 1) {
+            status = 3113;
+            goto error;
+        }
+    }
+    for (k = 0; k < GLYPH_FILE_BUCKETS; k++) {
+        for (entry = file->buckets[k]; entry != NULL; entry = entry->next) {
+            if (entry->saved) {
+                continue;
+            }
+            n_bitmap = (size_t)entry->rec.width * entry->rec.height;
+            if (fwrite(&entry->rec,sizeof(GlyphFileRecord),1,f) != 1
+                    || (n_bitmap != 0 && fwrite(entry->bitmap,n_bitmap,1,f) != 1)
+                    || (glyph_file_bitmap_bytes(&entry->rec) != n_bitmap
+                        && fwrite(padding,glyph_file_bitmap_bytes(&entry->rec) - n_bitmap,1,f) != 1)) {
+                status = 3113;
+                goto error;
+            }
+        }
+    }
+    status = fclose(f);
+    f = NULL;
+    if (status) {
+        status = 3113;
+        goto error;
+    }
+
+    for (k = 0; k < GLYPH_FILE_BUCKETS; k++) {
+        for (entry = file->buckets[k]; entry != NULL; entry = entry->next) {
+            entry->saved = 1;
+        }
+    }
+    file->rewrite = 0;
+
+    status = 0;
+
+error:
+    if (f != NULL) {
+        fclose(f);
+    }
+    return status;
+}
+
+
+int parlay_open_glyph_cache(const char* filename) {
+    if (default_context == NULL) {
+        return 3100;
+    }
+    return parlay_context_open_glyph_cache(default_context,filename);
+}
+
+
+int parlay_save_glyph_cache(void) {
+    if (default_context == NULL) {
+        return 3110;
+    }
+    return parlay_context_save_glyph_cache(default_context);
+}
+
+
+int parlay_context_plain_text_to_target(ParlayContext* ctx, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, const ParlayRGBATarget* target, ParlayRGBARawImage* image) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(text),&layout);
+    if (status) {
+        goto error;
+    }
+
+    status = lay_out_plain_text(ctx,layout,text,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = render_layout_to_target(ctx,layout,ctl->background_color,target,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_plain_text_to_target(const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        const ParlayRGBATarget* target, ParlayRGBARawImage* image) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_plain_text_to_target(default_context,text,style,ctl,target,image);
+}
+
+
+int parlay_context_measure_text(ParlayContext* ctx, const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayTextMetrics* metrics) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(text),&layout);
+    if (status) {
+        goto error;
+    }
+    layout->metrics_only = 1;
+
+    status = lay_out_plain_text(ctx,layout,text,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = measure_layout(layout,ctl,metrics);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_measure_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayTextMetrics* metrics) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_measure_text(default_context,text,style,ctl,metrics);
+}
+
+
+#if PARLAY_USE_MINIXML
+
+static int lay_out_element(ParlayContext* ctx, ParlayLayout* layout, mxml_node_t* node,
+        const ParlayStyle* parent_style, unsigned wrap_width, int is_top_element, int collapse_whitespace) {
+    ParlayStyle style;
+    const char* tag;
+    const char* w;
+    int i, c;
+    float x;
+    mxml_node_t* subnode;
+    mxml_type_t subtype;
+    int parse_style_attributes;
+    int status = 9999;
+
+    memcpy(&style,parent_style,sizeof(ParlayStyle));
+
+    tag = mxmlGetElement(node);
+    if (is_top_element) {
+        if (strcmp(tag,"p")) {
+            status = 301;
+            goto error;
+        }
+        parse_style_attributes = 1;
+    } else if (!strcmp(tag,"span")) {
+        parse_style_attributes = 1;
+    } else if (!strcmp(tag,"b")) {
+        style.font_style |= PARLAY_STYLE_BOLD;
+        parse_style_attributes = 0;
+    } else if (!strcmp(tag,"i")) {
+        style.font_style |= PARLAY_STYLE_ITALIC;
+        parse_style_attributes = 0;
+    } else if (!strcmp(tag,"u")) {
+        parse_style_attributes = 0;
+        style.underline = 1;
+    } else {
+        status = 302;
+        goto error;
+    }
+
+    if (parse_style_attributes) {
+        w = mxmlElementGetAttr(node,"font");
+        if (w != NULL) {
+            style.font_name = w;
+        }
+        w = mxmlElementGetAttr(node,"style");
+        if (w != NULL) {
+            if (!strcmp(w,"normal")) {
+                style.font_style = PARLAY_STYLE_NORMAL;
+            } else if (!strcmp(w,"italic")) {
+                style.font_style = PARLAY_STYLE_ITALIC;
+            } else if (!strcmp(w,"bold")) {
+                style.font_style = PARLAY_STYLE_BOLD;
+            } else if (!strcmp(w,"bold italic")) {
+                style.font_style = PARLAY_STYLE_BOLD_ITALIC;
+            } else {
+                status = 303;
+                goto error;
+            }
+        }
+        w = mxmlElementGetAttr(node,"size");
+        if (w != NULL) {
+            x = atof(w);
+            if (x <= 0) {
+                status = 304;
+                goto error;
+            }
+            style.font_size = x;
+        }
+        w = mxmlElementGetAttr(node,"color");
+        if (w != NULL) {
+            if (strlen(w) != 7 || w[0] != '#') {
+                status = 305;
+                goto error;
+            }
+            for (i = 0; i < 3; i++) {
+                c = get_hex02_value(&w[1+2*i]);
+                if (c == -1) {
+                    status = 306;
+                    goto error;
+                }
+                style.text_color[i] = c / 255.0;
+            }
+        }
+        w = mxmlElementGetAttr(node,"border");
+        if (w != NULL) {
+            i = atoi(w);
+            if (i < 0) {
+                status = 307;
+                goto error;
+            }
+            style.border_thickness = i;
+        }
+        w = mxmlElementGetAttr(node,"border_color");
+        if (w != NULL) {
+            if (strlen(w) != 7 || w[0] != '#') {
+                status = 308;
+                goto error;
+            }
+            for (i = 0; i < 3; i++) {
+                c = get_hex02_value(&w[1+2*i]);
+                if (c == -1) {
+                    status = 309;
+                    goto error;
+                }
+                style.border_color[i] = c / 255.0;
+            }
+        }
+        w = mxmlElementGetAttr(node,"border_method");
+        if (w != NULL) {
+            if (!strcmp(w,"smear")) {
+                style.border_method = PARLAY_BORDER_SMEAR;
+            } else if (!strcmp(w,"dilate")) {
+                style.border_method = PARLAY_BORDER_DILATE;
+            } else if (!strcmp(w,"stroke")) {
+                style.border_method = PARLAY_BORDER_STROKE;
+            } else {
+                status = 313;
+                goto error;
+            }
+        }
+        w = mxmlElementGetAttr(node,"highlight_color");
+        if (w != NULL) {
+            if (strlen(w) != 7 || w[0] != '#') {
+                status = 308;
+                goto error;
+            }
+            for (i = 0; i < 3; i++) {
+                c = get_hex02_value(&w[1+2*i]);
+                if (c == -1) {
+                    status = 309;
+                    goto error;
+                }
+                style.highlight_color[i] = c / 255.0;
+            }
+            style.highlight = 1;
+        }
+        w = mxmlElementGetAttr(node,"visibility");
+        if (w != NULL) {
+            x = atof(w);
+            if (x < 0 || x > 1) {
+                status = 310;
+                goto error;
+            }
+            style.text_color[3] = x;
+            style.border_color[3] = x;
+        }
+        w = mxmlElementGetAttr(node,"underline");
+        if (w != NULL) {
+            c = atoi(w);
+            if (c != 0 && c != 1) {
+                status = 311;
+                goto error;
+            }
+            style.underline = c;
+        }
+    }
+
+    subnode = mxmlGetFirstChild(node);
+    while (subnode != NULL) {
+        subtype = mxmlGetType(subnode);
+        switch (subtype) {
+
+        case MXML_ELEMENT:
+            tag = mxmlGetElement(subnode);
+            if (!strcmp(tag,"br")) {
+                w = "\n";
+                status = add_text_to_layout(ctx,layout,&w,&style,wrap_width,0,1);
+            } else {
+                status = lay_out_element(ctx,layout,subnode,&style,wrap_width,0,collapse_whitespace);
+            }
+            if (status) {
+                goto error;
+            }
+            break;
+
+        case MXML_OPAQUE:
+            w = mxmlGetOpaque(subnode);
+            status = add_text_to_layout(ctx,layout,&w,&style,wrap_width,collapse_whitespace,SIZE_MAX);
+            if (status) {
+                goto error;
+            }
+            break;
+
+        default:
+            status = 312;
+            goto error;
+        }
+
+        subnode = mxmlGetNextSibling(subnode);
+    }
+
+    status = 0;
+
+error:
+    return status;
+}
+
+
+// Lays out markup into an empty layout, ready to be rasterized
+
+static int lay_out_markup_text(ParlayContext* ctx, ParlayLayout* layout, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl) {
+    mxml_node_t* top_node = NULL;
+    const char* w;
+    int text_alignment;
+    int status = 9999;
+
+    top_node = mxmlLoadString(NULL,xml,MXML_OPAQUE_CALLBACK);
+    if (top_node == NULL) {
+        status = 201;
+        goto error;
+    }
+
+    layout->kerning = ctl->kerning == PARLAY_KERNING_ON;
+    layout->line_breaking = ctl->line_breaking == PARLAY_BREAK_OPTIMAL ? PARLAY_BREAK_OPTIMAL : PARLAY_BREAK_GREEDY;
+    status = lay_out_element(ctx,layout,top_node,style,ctl->width,1,ctl->collapse_whitespace);
+    if (status) {
+        goto error;
+    }
+
+    status = finalize_layout(ctx,layout,ctl->cropping_strategy,ctl->width);
+    if (status) {
+        goto error;
+    }
+    layout->fixed_width = ctl->width;
+
+    w = mxmlElementGetAttr(top_node,"align");
+    if (w == NULL) {
+        text_alignment = ctl->text_alignment;
+    } else if (!strcmp(w,"left")) {
+        text_alignment = PARLAY_ALIGN_LEFT;
+    } else if (!strcmp(w,"center")) {
+        text_alignment = PARLAY_ALIGN_CENTER;
+    } else if (!strcmp(w,"right")) {
+        text_alignment = PARLAY_ALIGN_RIGHT;
+    } else {
+        status = 202;
+        goto error;
+    }
+
+    status = realign(layout,text_alignment);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (top_node != NULL) {
+        mxmlDelete(top_node);
+    }
+
+    return status;
+}
+
+
+static int render_markup_text(ParlayContext* ctx, ParlayLayout* layout, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    int status = 9999;
+
+    status = lay_out_markup_text(ctx,layout,xml,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = render_layout(ctx,layout,ctl->background_color,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    return status;
+}
+
+
+int parlay_context_markup_text(ParlayContext* ctx, const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(xml)*3/4,&layout);
+    if (status) {
+        goto error;
+    }
+
+    status = render_markup_text(ctx,layout,xml,style,ctl,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_markup_text(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_markup_text(default_context,xml,style,ctl,image);
+}
+
+
+
+int parlay_context_markup_text_to_target(ParlayContext* ctx, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, const ParlayRGBATarget* target, ParlayRGBARawImage* image) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(xml)*3/4,&layout);
+    if (status) {
+        goto error;
+    }
+
+    status = lay_out_markup_text(ctx,layout,xml,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = render_layout_to_target(ctx,layout,ctl->background_color,target,image);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_markup_text_to_target(const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        const ParlayRGBATarget* target, ParlayRGBARawImage* image) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_markup_text_to_target(default_context,xml,style,ctl,target,image);
+}
+
+
+
+int parlay_context_measure_markup(ParlayContext* ctx, const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayTextMetrics* metrics) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(xml)*3/4,&layout);
+    if (status) {
+        goto error;
+    }
+    layout->metrics_only = 1;
+
+    status = lay_out_markup_text(ctx,layout,xml,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    status = measure_layout(layout,ctl,metrics);
+    if (status) {
+        goto error;
+    }
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_measure_markup(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayTextMetrics* metrics) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_measure_markup(default_context,xml,style,ctl,metrics);
+}
+
+#endif
+
+
+// A batch job renders every stride-th item starting at first, reusing one
+// layout for all of them.  Items that fail are left as empty images, and the
+// job remembers the first one that did.
+
+static int render_batch_items(BatchJob* job) {
+    ParlayLayout* layout = NULL;
+    const ParlayBatchItem* item;
+    ParlayRGBARawImage* image;
+    size_t i;
+    int status = 9999;
+
+    job->failed_item = SIZE_MAX;
+    job->status = 0;
+
+    status = new_layout(64,&layout);
+    if (status) {
+        goto error;
+    }
+
+    for (i = job->first; i < job->n_items; i += job->stride) {
+        item = &job->items[i];
+        image = &job->images[i];
+        image->data = NULL;
+        reset_layout(layout);
+        if (item->is_markup) {
+#if PARLAY_USE_MINIXML
+            status = render_markup_text(job->ctx,layout,item->text,item->style,item->ctl,image);
+#else
+            status = 2104;
+#endif
+        } else {
+            status = render_plain_text(job->ctx,layout,item->text,item->style,item->ctl,image);
+        }
+        if (status) {
+            parlay_free_image_data(image);
+            if (job->failed_item == SIZE_MAX) {
+                job->failed_item = i;
+                job->status = status;
+            }
+        }
+        if (job->statuses != NULL) {
+            job->statuses[i] = status;
+        }
+    }
 
     status = 0;
 
 error:
-    if (work != NULL) {
-        free(work);
-    }
-    if (data != NULL) {
-        free(data);
+    if (layout != NULL) {
+        delete_layout(layout);
     }
     return status;
 }
 
 
+#if PARLAY_THREADS_WIN32
 
-static int final_offset(ParlayLayout* layout, ParlayRGBARawImage* image, int fixed_width, int text_alignment) {
-    if (fixed_width != 0) {
-        if (text_alignment == PARLAY_ALIGN_CENTER) {
-            image->x0 += (fixed_width - layout->width) / 2;
-        } else if (text_alignment == PARLAY_ALIGN_RIGHT) {
-            image->x0 += fixed_width - layout->width;
-        }
-    }
+static DWORD WINAPI batch_thread_main(LPVOID arg) {
+    BatchJob* job = (BatchJob*)arg;
+    job->thread_status = render_batch_items(job);
     return 0;
 }
 
+static int start_batch_thread(BatchJob* job) {
+    job->thread = CreateThread(NULL,0,batch_thread_main,job,0,NULL);
+    return job->thread == NULL;
+}
 
+static void join_batch_thread(BatchJob* job) {
+    WaitForSingleObject(job->thread,INFINITE);
+    CloseHandle(job->thread);
+}
 
+#elif PARLAY_THREADS_POSIX
 
-//---------------------------------------------------------------------
-// Paragraph functions
+static void* batch_thread_main(void* arg) {
+    BatchJob* job = (BatchJob*)arg;
+    job->thread_status = render_batch_items(job);
+    return NULL;
+}
 
-int parlay_init(void) {
-    int status;
-    if (library == NULL) {
-        status = FT_Init_FreeType(&library);
-        if (status) {
-            return 1;
-        }
+static int start_batch_thread(BatchJob* job) {
+    return pthread_create(&job->thread,NULL,batch_thread_main,job) != 0;
+}
+
+static void join_batch_thread(BatchJob* job) {
+    pthread_join(job->thread,NULL);
+}
+
+#else
+
+static int start_batch_thread(BatchJob* job) {
+    (void)job;
+    return 1;
+}
+
+static void join_batch_thread(BatchJob* job) {
+    (void)job;
+}
+
+#endif
+
+
+// Batches are striped across n_threads jobs.  The first job runs on the
+// calling thread with ctx; the others each get a clone of ctx, which is kept
+// for the next batch.  If a thread can't be started, its job runs on the
+// calling thread afterwards.
+
+int parlay_context_render_batch(ParlayContext* ctx, const ParlayBatchItem* items, size_t n_items, int n_threads,
+        ParlayRGBARawImage* images, int* statuses) {
+    BatchJob* jobs = NULL;
+    ParlayContext** workers;
+    size_t failed_item;
+    int i;
+    int status = 9999;
+
+#if !PARLAY_THREADS_WIN32 && !PARLAY_THREADS_POSIX
+    n_threads = 1;
+#endif
+    if (n_threads < 1) {
+        n_threads = 1;
     }
-    if (manager == NULL) {
-        status = FTC_Manager_New(library,0,0,0,load_face_callback,NULL,&manager);
-        if (status) {
-            return 2;
+    if ((size_t)n_threads > n_items) {
+        n_threads = n_items > 0 ? (int)n_items : 1;
+    }
+
+    if (n_threads-1 > ctx->n_batch_workers) {
+        workers = (ParlayContext**)realloc(ctx->batch_workers,(n_threads-1)*sizeof(ParlayContext*));
+        if (workers == NULL) {
+            status = 2101;
+            goto error;
+        }
+        ctx->batch_workers = workers;
+        while (ctx->n_batch_workers < n_threads-1) {
+            if (parlay_context_clone(ctx,&ctx->batch_workers[ctx->n_batch_workers])) {
+                status = 2102;
+                goto error;
+            }
+            ctx->n_batch_workers++;
         }
     }
-    if (cmap_cache == NULL) {
-        status = FTC_CMapCache_New(manager,&cmap_cache);
-        if (status) {
-            return 3;
+
+    jobs = (BatchJob*)malloc(n_threads*sizeof(BatchJob));
+    if (jobs == NULL) {
+        status = 2101;
+        goto error;
+    }
+    for (i = 0; i < n_threads; i++) {
+        jobs[i].ctx = i == 0 ? ctx : ctx->batch_workers[i-1];
+        jobs[i].items = items;
+        jobs[i].n_items = n_items;
+        jobs[i].first = i;
+        jobs[i].stride = n_threads;
+        jobs[i].images = images;
+        jobs[i].statuses = statuses;
+        jobs[i].thread_status = 0;
+        jobs[i].started = 0;
+    }
+
+    for (i = 1; i < n_threads; i++) {
+        if (start_batch_thread(&jobs[i]) == 0) {
+            jobs[i].started = 1;
         }
     }
-    if (sbit_cache == NULL) {
-        status = FTC_SBitCache_New(manager,&sbit_cache);
-        if (status) {
-            return 4;
+    jobs[0].thread_status = render_batch_items(&jobs[0]);
+    for (i = 1; i < n_threads; i++) {
+        if (jobs[i].started) {
+            join_batch_thread(&jobs[i]);
+        } else {
+            jobs[i].thread_status = render_batch_items(&jobs[i]);
         }
     }
-    if (image_cache == NULL) {
-        status = FTC_ImageCache_New(manager,&image_cache);
-        if (status) {
-            return 5;
+
+    status = 0;
+    failed_item = SIZE_MAX;
+    for (i = 0; i < n_threads; i++) {
+        if (jobs[i].thread_status) {
+            status = jobs[i].thread_status;
+            goto error;
+        }
+        if (jobs[i].status && jobs[i].failed_item < failed_item) {
+            failed_item = jobs[i].failed_item;
+            status = jobs[i].status;
         }
     }
+
+error:
+    if (jobs != NULL) {
+        free(jobs);
+    }
+    return status;
+}
+
+
+int parlay_render_batch(const ParlayBatchItem* items, size_t n_items, int n_threads, ParlayRGBARawImage* images,
+        int* statuses) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_render_batch(default_context,items,n_items,n_threads,images,statuses);
+}
+
+
+int parlay_atlas_new(int page_width, int page_height, int padding, ParlayAtlas** ratlas) {
+    ParlayAtlas* atlas;
+    if (page_width <= 0 || page_height <= 0 || padding < 0) {
+        return 1;
+    }
+    atlas = (ParlayAtlas*)calloc(1,sizeof(ParlayAtlas));
+    if (atlas == NULL) {
+        return 2;
+    }
+    atlas->page_width = page_width;
+    atlas->page_height = page_height;
+    atlas->padding = padding;
+    *ratlas = atlas;
     return 0;
 }
 
 
-int parlay_finalize(void) {
-    int status;
-    if (library != NULL) {
-        status = FT_Done_FreeType(library);
-        if (status) {
-            return 9;
-        }
-        image_cache = NULL;
-        sbit_cache = NULL;
-        cmap_cache = NULL;
-        manager = NULL;
-        library = NULL;
+int parlay_atlas_delete(ParlayAtlas* atlas) {
+    size_t p;
+    for (p = 0; p < atlas->n_pages; p++) {
+        free(atlas->pages[p].data);
+        free(atlas->pages[p].skyline);
     }
+    if (atlas->pages != NULL) {
+        free(atlas->pages);
+    }
+    free(atlas);
     return 0;
 }
 
 
-int parlay_plain_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
-    ParlayLayout* layout = NULL;
-    int status = 9999;
+int parlay_atlas_get_page_count(const ParlayAtlas* atlas, int* rcount) {
+    *rcount = (int)atlas->n_pages;
+    return 0;
+}
 
-    status = new_layout(strlen(text),&layout);
-    if (status) {
-        goto error;
-    }
 
-    status = add_text_to_layout(layout,&text,style,ctl->width,ctl->collapse_whitespace,SIZE_MAX);
-    if (status) {
-        goto error;
-    }
+// The page image still belongs to the atlas; don't pass it to
+// parlay_free_image_data
 
-    status = finalize_layout(layout,ctl->cropping_strategy,ctl->width);
-    if (status) {
-        goto error;
+int parlay_atlas_get_page(const ParlayAtlas* atlas, int page, ParlayRGBARawImage* image) {
+    if (page < 0 || (size_t)page >= atlas->n_pages) {
+        return 2301;
     }
+    image->data = atlas->pages[page].data;
+    image->width = atlas->page_width;
+    image->height = atlas->page_height;
+    image->x0 = 0;
+    image->y0 = 0;
+    return 0;
+}
 
-    status = realign(layout,ctl->text_alignment);
+
+int parlay_context_atlas_plain_text(ParlayContext* ctx, ParlayAtlas* atlas, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayAtlasEntry* entry) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(text),&layout);
     if (status) {
         goto error;
     }
 
-    status = rasterize(layout,ctl->background_color,image);
+    status = lay_out_plain_text(ctx,layout,text,style,ctl);
     if (status) {
         goto error;
     }
 
-    status = final_offset(layout,image,ctl->width,ctl->text_alignment);
+    status = add_layout_to_atlas(ctx,atlas,layout,ctl,entry);
     if (status) {
         goto error;
     }
@@ -1101,261 +6892,422 @@ error:
 }
 
 
+int parlay_atlas_plain_text(ParlayAtlas* atlas, const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayAtlasEntry* entry) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_atlas_plain_text(default_context,atlas,text,style,ctl,entry);
+}
+
+
 #if PARLAY_USE_MINIXML
 
-static int lay_out_element(ParlayLayout* layout, mxml_node_t* node,
-        const ParlayStyle* parent_style, unsigned wrap_width, int is_top_element, int collapse_whitespace) {
-    ParlayStyle style;
-    const char* tag;
-    const char* w;
-    int i, c;
-    float x;
-    mxml_node_t* subnode;
-    mxml_type_t subtype;
-    int parse_style_attributes;
+int parlay_context_atlas_markup_text(ParlayContext* ctx, ParlayAtlas* atlas, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayAtlasEntry* entry) {
+    ParlayLayout* layout = NULL;
     int status = 9999;
 
-    memcpy(&style,parent_style,sizeof(ParlayStyle));
-
-    tag = mxmlGetElement(node);
-    if (is_top_element) {
-        if (strcmp(tag,"p")) {
-            status = 301;
-            goto error;
-        }
-        parse_style_attributes = 1;
-    } else if (!strcmp(tag,"span")) {
-        parse_style_attributes = 1;
-    } else if (!strcmp(tag,"b")) {
-        style.font_style |= PARLAY_STYLE_BOLD;
-        parse_style_attributes = 0;
-    } else if (!strcmp(tag,"i")) {
-        style.font_style |= PARLAY_STYLE_ITALIC;
-        parse_style_attributes = 0;
-    } else if (!strcmp(tag,"u")) {
-        parse_style_attributes = 0;
-        style.underline = 1;
-    } else {
-        status = 302;
+    status = new_layout(strlen(xml)*3/4,&layout);
+    if (status) {
         goto error;
     }
 
-    if (parse_style_attributes) {
-        w = mxmlElementGetAttr(node,"font");
-        if (w != NULL) {
-            style.font_name = w;
-        }
-        w = mxmlElementGetAttr(node,"style");
-        if (w != NULL) {
-            if (!strcmp(w,"normal")) {
-                style.font_style = PARLAY_STYLE_NORMAL;
-            } else if (!strcmp(w,"italic")) {
-                style.font_style = PARLAY_STYLE_ITALIC;
-            } else if (!strcmp(w,"bold")) {
-                style.font_style = PARLAY_STYLE_BOLD;
-            } else if (!strcmp(w,"bold italic")) {
-                style.font_style = PARLAY_STYLE_BOLD_ITALIC;
-            } else {
-                status = 303;
-                goto error;
-            }
-        }
-        w = mxmlElementGetAttr(node,"size");
-        if (w != NULL) {
-            x = atof(w);
-            if (x <= 0) {
-                status = 304;
-                goto error;
-            }
-            style.font_size = x;
-        }
-        w = mxmlElementGetAttr(node,"color");
-        if (w != NULL) {
-            if (strlen(w) != 7 || w[0] != '#') {
-                status = 305;
-                goto error;
-            }
-            for (i = 0; i < 3; i++) {
-                c = get_hex02_value(&w[1+2*i]);
-                if (c == -1) {
-                    status = 306;
-                    goto error;
-                }
-                style.text_color[i] = c / 255.0;
-            }
-        }
-        w = mxmlElementGetAttr(node,"border");
-        if (w != NULL) {
-            i = atoi(w);
-            if (i < 0) {
-                status = 307;
-                goto error;
-            }
-            style.border_thickness = i;
-        }
-        w = mxmlElementGetAttr(node,"border_color");
-        if (w != NULL) {
-            if (strlen(w) != 7 || w[0] != '#') {
-                status = 308;
-                goto error;
-            }
-            for (i = 0; i < 3; i++) {
-                c = get_hex02_value(&w[1+2*i]);
-                if (c == -1) {
-                    status = 309;
-                    goto error;
-                }
-                style.border_color[i] = c / 255.0;
-            }
-        }
-        w = mxmlElementGetAttr(node,"highlight_color");
-        if (w != NULL) {
-            if (strlen(w) != 7 || w[0] != '#') {
-                status = 308;
-                goto error;
-            }
-            for (i = 0; i < 3; i++) {
-                c = get_hex02_value(&w[1+2*i]);
-                if (c == -1) {
-                    status = 309;
-                    goto error;
-                }
-                style.highlight_color[i] = c / 255.0;
-            }
-            style.highlight = 1;
-        }
-        w = mxmlElementGetAttr(node,"visibility");
-        if (w != NULL) {
-            x = atof(w);
-            if (x < 0 || x > 1) {
-                status = 310;
-                goto error;
-            }
-            style.text_color[3] = x;
-            style.border_color[3] = x;
-        }
-        w = mxmlElementGetAttr(node,"underline");
-        if (w != NULL) {
-            c = atoi(w);
-            if (c != 0 && c != 1) {
-                status = 311;
-                goto error;
-            }
-            style.underline = c;
-        }
+    status = lay_out_markup_text(ctx,layout,xml,style,ctl);
+    if (status) {
+        goto error;
     }
 
-    subnode = mxmlGetFirstChild(node);
-    while (subnode != NULL) {
-        subtype = mxmlGetType(subnode);
-        switch (subtype) {
+    status = add_layout_to_atlas(ctx,atlas,layout,ctl,entry);
+    if (status) {
+        goto error;
+    }
+    status = 0;
 
-        case MXML_ELEMENT:
-            tag = mxmlGetElement(subnode);
-            if (!strcmp(tag,"br")) {
-                w = "\n";
-                status = add_text_to_layout(layout,&w,&style,wrap_width,0,1);
-            } else {
-                status = lay_out_element(layout,subnode,&style,wrap_width,0,collapse_whitespace);
-            }
-            if (status) {
-                goto error;
-            }
-            break;
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
 
-        case MXML_OPAQUE:
-            w = mxmlGetOpaque(subnode);
-            status = add_text_to_layout(layout,&w,&style,wrap_width,collapse_whitespace,SIZE_MAX);
-            if (status) {
-                goto error;
-            }
-            break;
+    return status;
+}
 
-        default:
-            status = 312;
-            goto error;
-        }
 
-        subnode = mxmlGetNextSibling(subnode);
+int parlay_atlas_markup_text(ParlayAtlas* atlas, const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayAtlasEntry* entry) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_atlas_markup_text(default_context,atlas,xml,style,ctl,entry);
+}
+
+#endif
+
+
+// A layout handed out by the public API is finished and aligned, so it can
+// be rendered any number of times.  Only colors, visibility, and opacity can
+// change afterwards; anything that would move glyphs needs a new layout.
+
+int parlay_context_layout_plain_text(ParlayContext* ctx, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayLayout** rlayout) {
+    ParlayLayout* layout = NULL;
+    int status = 9999;
+
+    status = new_layout(strlen(text),&layout);
+    if (status) {
+        goto error;
     }
+    layout->ctx = ctx;
+
+    status = lay_out_plain_text(ctx,layout,text,style,ctl);
+    if (status) {
+        goto error;
+    }
+
+    *rlayout = layout;
+    layout = NULL;
 
     status = 0;
 
 error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
     return status;
 }
 
 
-int parlay_markup_text(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+int parlay_layout_plain_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayLayout** rlayout) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_layout_plain_text(default_context,text,style,ctl,rlayout);
+}
+
+
+#if PARLAY_USE_MINIXML
+
+int parlay_context_layout_markup_text(ParlayContext* ctx, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayLayout** rlayout) {
     ParlayLayout* layout = NULL;
-    mxml_node_t* top_node = NULL;
-    const char* w;
-    int text_alignment;
     int status = 9999;
 
-    top_node = mxmlLoadString(NULL,xml,MXML_OPAQUE_CALLBACK);
-    if (top_node == NULL) {
-        status = 201;
+    status = new_layout(strlen(xml)*3/4,&layout);
+    if (status) {
         goto error;
     }
+    layout->ctx = ctx;
 
-    status = new_layout(strlen(xml)*3/4,&layout);
+    status = lay_out_markup_text(ctx,layout,xml,style,ctl);
     if (status) {
         goto error;
     }
 
-    status = lay_out_element(layout,top_node,style,ctl->width,1,ctl->collapse_whitespace);
+    *rlayout = layout;
+    layout = NULL;
+
+    status = 0;
+
+error:
+    if (layout != NULL) {
+        delete_layout(layout);
+    }
+
+    return status;
+}
+
+
+int parlay_layout_markup_text(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayLayout** rlayout) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_layout_markup_text(default_context,xml,style,ctl,rlayout);
+}
+
+#endif
+
+
+int parlay_layout_delete(ParlayLayout* layout) {
+    delete_layout(layout);
+    return 0;
+}
+
+
+// Glyphs are numbered in text order.  Every character gets one, except line
+// breaks and whitespace that was collapsed away.
+
+int parlay_layout_get_glyph_count(const ParlayLayout* layout, size_t* rcount) {
+    *rcount = layout->n_glyphs;
+    return 0;
+}
+
+
+// Clips a glyph range to the layout; a range starting past the end is an
+// error, but one that runs past the end just stops there
+
+static int clip_glyph_range(const ParlayLayout* layout, size_t first, size_t* rcount) {
+    if (first > layout->n_glyphs) {
+        return 1;
+    }
+    if (*rcount > layout->n_glyphs - first) {
+        *rcount = layout->n_glyphs - first;
+    }
+    return 0;
+}
+
+
+// A NULL color is left as it was.  Border and highlight colors only show on
+// glyphs that were laid out with a border or highlight.
+
+int parlay_layout_set_colors(ParlayLayout* layout, size_t first, size_t count, const float text_color[4],
+        const float border_color[4], const float highlight_color[4]) {
+    ParlayGlyphPlan* gp;
+    size_t k;
+
+    if (clip_glyph_range(layout,first,&count)) {
+        return 2601;
+    }
+    for (k = first; k < first+count; k++) {
+        gp = &layout->glyph_plans[k];
+        if (text_color != NULL) {
+            memcpy(gp->text_color,text_color,4*sizeof(float));
+        }
+        if (border_color != NULL) {
+            memcpy(gp->border_color,border_color,4*sizeof(float));
+        }
+        if (highlight_color != NULL) {
+            memcpy(gp->highlight_color,highlight_color,4*sizeof(float));
+        }
+    }
+    return 0;
+}
+
+
+// Hidden glyphs aren't drawn but still take up their space, so showing them
+// one at a time doesn't move anything
+
+int parlay_layout_set_visible(ParlayLayout* layout, size_t first, size_t count, int visible) {
+    size_t k;
+
+    if (clip_glyph_range(layout,first,&count)) {
+        return 2602;
+    }
+    for (k = first; k < first+count; k++) {
+        layout->glyph_plans[k].hidden = !visible;
+    }
+    return 0;
+}
+
+
+int parlay_layout_set_opacity(ParlayLayout* layout, float opacity) {
+    if (opacity < 0.0f || opacity > 1.0f) {
+        return 2603;
+    }
+    layout->opacity = opacity;
+    return 0;
+}
+
+
+// Only the background color is taken from the control structure; the width,
+// alignment, and cropping were fixed when the layout was made
+
+int parlay_layout_render(ParlayLayout* layout, const ParlayControl* ctl, ParlayRGBARawImage* image) {
+    int status = 9999;
+
+    status = render_layout(layout->ctx,layout,ctl->background_color,image);
     if (status) {
         goto error;
     }
 
-    status = finalize_layout(layout,ctl->cropping_strategy,ctl->width);
-    if (status) {
+    if (record_drawn_layout(layout,ctl->background_color)) {
+        status = 2802;
         goto error;
     }
+    status = 0;
 
-    w = mxmlElementGetAttr(top_node,"align");
-    if (w == NULL) {
-        text_alignment = ctl->text_alignment;
-    } else if (!strcmp(w,"left")) {
-        text_alignment = PARLAY_ALIGN_LEFT;
-    } else if (!strcmp(w,"center")) {
-        text_alignment = PARLAY_ALIGN_CENTER;
-    } else if (!strcmp(w,"right")) {
-        text_alignment = PARLAY_ALIGN_RIGHT;
+error:
+    return status;
+}
+
+
+int parlay_layout_render_to_target(ParlayLayout* layout, const ParlayControl* ctl, const ParlayRGBATarget* target,
+        ParlayRGBARawImage* image) {
+    return render_layout_to_target(layout->ctx,layout,ctl->background_color,target,image);
+}
+
+
+// Updates an image that holds the last render of previous (or of layout
+// itself, if previous is NULL) so that it shows layout, redrawing only the
+// glyphs that changed.  If the two layouts aren't the same size and shape,
+// or the background or opacity changed, the image is rendered from scratch
+// and the whole of it is returned as dirty.
+
+int parlay_layout_render_update(ParlayLayout* layout, const ParlayLayout* previous, const ParlayControl* ctl,
+        ParlayRGBARawImage* image, ParlayRect* rects, size_t max_rects, size_t* rn_rects) {
+    const ParlayLayout* base = previous != NULL ? previous : layout;
+    int status = 9999;
+
+    if (!base->drawn || image->data == NULL || image->width != (size_t)layout->width
+            || image->height != (size_t)layout->height || base->width != layout->width
+            || base->height != layout->height || base->x_image_offset != layout->x_image_offset
+            || base->y_image_offset != layout->y_image_offset || base->drawn_opacity != layout->opacity
+            || memcmp(base->drawn_background_color,ctl->background_color,4*sizeof(float))) {
+        parlay_free_image_data(image);
+        status = render_layout(layout->ctx,layout,ctl->background_color,image);
+        if (status) {
+            goto error;
+        }
+        *rn_rects = 0;
+        if (max_rects > 0) {
+            rects[0].x = 0;
+            rects[0].y = 0;
+            rects[0].width = layout->width;
+            rects[0].height = layout->height;
+            *rn_rects = 1;
+        }
     } else {
-        status = 202;
+        status = update_layout_image(layout->ctx,layout,base->drawn_plans,base->n_drawn,ctl->background_color,
+                image,rects,max_rects,rn_rects);
+        if (status) {
+            goto error;
+        }
+        image->x0 = layout->x_image_offset;
+        image->y0 = layout->y_image_offset;
+        final_offset(layout,image,layout->fixed_width,layout->text_alignment);
+    }
+
+    if (record_drawn_layout(layout,ctl->background_color)) {
+        status = 2802;
         goto error;
     }
+    status = 0;
 
-    status = realign(layout,text_alignment);
-    if (status) {
+error:
+    return status;
+}
+
+
+// A builder needs a wrap width, which is also the width of its image.  The
+// cropping strategy is ignored; a builder's image is always cropped naturally.
+
+int parlay_context_builder_new(ParlayContext* ctx, const ParlayControl* ctl, ParlayParagraphBuilder** rbuilder) {
+    ParlayParagraphBuilder* builder = NULL;
+    ParlayLayout* layout;
+    int status = 9999;
+
+    if (ctl->width <= 0) {
+        status = 2701;
+        goto error;
+    }
+    if (ctl->text_alignment != PARLAY_ALIGN_LEFT && ctl->text_alignment != PARLAY_ALIGN_CENTER
+            && ctl->text_alignment != PARLAY_ALIGN_RIGHT) {
+        status = 2702;
         goto error;
     }
 
-    status = rasterize(layout,ctl->background_color,image);
-    if (status) {
+    builder = (ParlayParagraphBuilder*)calloc(1,sizeof(ParlayParagraphBuilder));
+    if (builder == NULL) {
+        status = 2703;
         goto error;
     }
 
-    status = final_offset(layout,image,ctl->width,text_alignment);
+    status = new_layout(256,&builder->layout);
     if (status) {
         goto error;
     }
+
+    layout = builder->layout;
+    layout->ctx = ctx;
+    layout->width = ctl->width;
+    layout->fixed_width = ctl->width;
+    layout->x_image_offset = 0;
+    layout->y_image_offset = 0;
+    layout->text_alignment = ctl->text_alignment;
+    layout->kerning = ctl->kerning == PARLAY_KERNING_ON;
+
+    builder->text_alignment = ctl->text_alignment;
+    memcpy(builder->background_color,ctl->background_color,4*sizeof(float));
+    builder->collapse_whitespace = ctl->collapse_whitespace;
+    builder->stale_row = INT_MAX;
+
+    *rbuilder = builder;
+    builder = NULL;
+
     status = 0;
 
 error:
-    if (layout != NULL) {
-        delete_layout(layout);
+    if (builder != NULL) {
+        parlay_builder_delete(builder);
     }
-    if (top_node != NULL) {
-        mxmlDelete(top_node);
+
+    return status;
+}
+
+
+int parlay_builder_new(const ParlayControl* ctl, ParlayParagraphBuilder** rbuilder) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_builder_new(default_context,ctl,rbuilder);
+}
+
+
+int parlay_builder_delete(ParlayParagraphBuilder* builder) {
+    delete_layout(builder->layout);
+    if (builder->data != NULL) {
+        free(builder->data);
+    }
+    if (builder->saved != NULL) {
+        free(builder->saved);
+    }
+    free(builder);
+    return 0;
+}
+
+
+int parlay_builder_append_text(ParlayParagraphBuilder* builder, const char* text, const ParlayStyle* style) {
+    ParlayLayout* layout = builder->layout;
+    return add_text_to_layout(layout->ctx,layout,&text,style,layout->width,builder->collapse_whitespace,SIZE_MAX);
+}
+
+
+// The image data still belongs to the builder, and is only good until the
+// next call; don't pass it to parlay_free_image_data
+
+int parlay_builder_render(ParlayParagraphBuilder* builder, ParlayRGBARawImage* image, int* rdirty_y, int* rdirty_height) {
+    int status = 9999;
+
+    status = render_builder(builder,rdirty_y,rdirty_height);
+    if (status) {
+        goto error;
     }
 
+    image->data = builder->data;
+    image->width = builder->layout->width;
+    image->height = builder->height;
+    image->x0 = 0;
+    image->y0 = 0;
+
+    status = 0;
+
+error:
     return status;
 }
 
-#endif
+
+int parlay_free_text_metrics(ParlayTextMetrics* metrics) {
+    if (metrics->lines != NULL) {
+        free(metrics->lines);
+        metrics->lines = NULL;
+    }
+    metrics->n_lines = 0;
+    metrics->width = 0;
+    metrics->height = 0;
+    metrics->x0 = 0;
+    metrics->y0 = 0;
+    return 0;
+}
 
 
 int parlay_free_image_data(ParlayRGBARawImage* image) {
@@ -1369,3 +7321,73 @@ int parlay_free_image_data(ParlayRGBARawImage* image) {
     image->y0 = 0;
     return 0;
 }
+
+
+// Fields get added to ParlayStyle and ParlayControl over time, so these set
+// every field to its default, and the caller sets the ones it cares about.
+// The defaults are what earlier versions did before the field existed.
+// Nothing is drawn until a font and size are set, and text is opaque black.
+
+int parlay_style_defaults(ParlayStyle* style) {
+    memset(style,0,sizeof(ParlayStyle));
+    style->font_style = PARLAY_STYLE_NORMAL;
+    style->text_color[3] = 1.0f;
+    style->font_scaler = 1.0f;
+    style->border_method = PARLAY_BORDER_SMEAR;
+    style->font_handle = 0;
+    return 0;
+}
+
+
+int parlay_control_defaults(ParlayControl* ctl) {
+    memset(ctl,0,sizeof(ParlayControl));
+    ctl->text_alignment = PARLAY_ALIGN_LEFT;
+    ctl->cropping_strategy = PARLAY_CROP_NATURAL;
+    ctl->kerning = PARLAY_KERNING_OFF;
+    ctl->line_breaking = PARLAY_BREAK_GREEDY;
+    return 0;
+}
+
+
+// Text that fails with status 1205 isn't valid UTF-8; this says where and
+// why.  *roffset gets the byte offset of the first bad sequence, or the
+// length of the text if it's all valid.  The status says what's wrong: 2901
+// is a byte that can't start a character, 2902 a character cut short, 2903
+// an overlong form, 2904 a surrogate, and 2905 a code point past U+10FFFF.
+
+int parlay_check_utf8(const char* text, size_t* roffset) {
+    size_t n = strlen(text);
+    int kind;
+
+    *roffset = n;
+    kind = select_check_utf8()((const unsigned char*)text,n,roffset);
+    if (kind) {
+        return 2900 + kind;
+    }
+    return 0;
+}
+
+
+// Says why the last text laid out in the context failed with status 1205,
+// the same way parlay_check_utf8 does, with the byte offset of the bad
+// sequence in *roffset.  For plain text and builders the offset is into the
+// text that was passed in; for markup it's into the text of the element it
+// was in, after entities are replaced.  It returns 0, and *roffset is 0,
+// when the last text was valid or nothing has been laid out yet.  Batches
+// lay out in contexts of their own, so use parlay_check_utf8 on their items.
+
+int parlay_context_last_utf8_error(const ParlayContext* ctx, size_t* roffset) {
+    *roffset = ctx->utf8_error_offset;
+    if (ctx->utf8_error) {
+        return 2900 + ctx->utf8_error;
+    }
+    return 0;
+}
+
+
+int parlay_last_utf8_error(size_t* roffset) {
+    if (default_context == NULL) {
+        return 2001;
+    }
+    return parlay_context_last_utf8_error(default_context,roffset);
+}
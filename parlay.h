@@ -10,6 +10,18 @@
 #define PARLAY_USE_MINIXML 1
 #endif
 
+#ifndef PARLAY_USE_SIMD
+#define PARLAY_USE_SIMD 1
+#endif
+
+#ifndef PARLAY_USE_THREADS
+#define PARLAY_USE_THREADS 1
+#endif
+
+#ifndef PARLAY_USE_MMAP
+#define PARLAY_USE_MMAP 1
+#endif
+
 
 /* -------- Section two: Constants -------- */
 
@@ -20,12 +32,28 @@
 #define PARLAY_STYLE_BOLD 2
 #define PARLAY_STYLE_BOLD_ITALIC 3
 
+/* Border methods */
+
+#define PARLAY_BORDER_SMEAR 0
+#define PARLAY_BORDER_DILATE 1
+#define PARLAY_BORDER_STROKE 2
+
 /* Paragraph alignment */
 
 #define PARLAY_ALIGN_LEFT 0
 #define PARLAY_ALIGN_CENTER 1
 #define PARLAY_ALIGN_RIGHT 2
 
+/* Kerning */
+
+#define PARLAY_KERNING_OFF 0
+#define PARLAY_KERNING_ON 1
+
+/* Line breaking */
+
+#define PARLAY_BREAK_GREEDY 0
+#define PARLAY_BREAK_OPTIMAL 1
+
 /* Cropping */
 
 #define PARLAY_CROP_Y_MASK 255
@@ -47,6 +75,16 @@
 
 /* -------- Section three: Types -------- */
 
+/* A rendering context: FreeType library, caches, and registered fonts */
+
+typedef struct _ParlayContext ParlayContext;
+
+
+/* A registered font, found once by name; 0 is never a font */
+
+typedef unsigned ParlayFontHandle;
+
+
 /* Text style information */
 
 typedef struct {
@@ -60,6 +98,8 @@ typedef struct {
     float highlight_color[4];
     int underline;
     float font_scaler;
+    int border_method;
+    ParlayFontHandle font_handle;
     
     /* etc */
     /* other means of selecting color, incl. procedural */
@@ -76,6 +116,8 @@ typedef struct {
     float background_color[4];
     int collapse_whitespace;
     int cropping_strategy;
+    int kerning;
+    int line_breaking;
 
     /* line_spacing (single, double, etc.) */
     /* padding */
@@ -99,21 +141,291 @@ typedef struct {
 } ParlayRGBARawImage;
 
 
+/* The extent of one line of a measured paragraph, in image pixels */
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+    int baseline;
+} ParlayLineExtent;
+
+
+/* The size a paragraph would render at, without rendering it */
+
+typedef struct {
+    size_t width;
+    size_t height;
+    int x0;
+    int y0;
+    size_t n_lines;
+    ParlayLineExtent* lines;
+} ParlayTextMetrics;
+
+
+/* Caller-owned RGBA memory to render into */
+
+typedef struct {
+    unsigned char* data;
+    size_t pitch;
+    int width;
+    int height;
+    int x;
+    int y;
+    int clear_background;
+} ParlayRGBATarget;
+
+
+/* One paragraph of a batch */
+
+typedef struct {
+    const char* text;
+    int is_markup;
+    const ParlayStyle* style;
+    const ParlayControl* ctl;
+} ParlayBatchItem;
+
+
+/* A range of characters, first to last inclusive, to preload glyphs for */
+
+typedef struct {
+    unsigned long first;
+    unsigned long last;
+} ParlayCodepointRange;
+
+
+/* A set of RGBA pages that rendered paragraphs are packed into */
+
+typedef struct _ParlayAtlas ParlayAtlas;
+
+
+/* Where a paragraph was packed in an atlas */
+
+typedef struct {
+    int page;
+    int x;
+    int y;
+    int width;
+    int height;
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+    int x0;
+    int y0;
+} ParlayAtlasEntry;
+
+
+/* A rectangle of an image, in pixels */
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} ParlayRect;
+
+
+/* A laid-out paragraph that can be rendered more than once */
+
+typedef struct _ParlayLayout ParlayLayout;
+
+
+/* A paragraph that text can be appended to a piece at a time */
+
+typedef struct _ParlayParagraphBuilder ParlayParagraphBuilder;
+
+
 /* -------- Section four: Function prototypes -------- */
 
 int parlay_init(void);
 
+int parlay_init_with_limits(unsigned max_faces, unsigned max_sizes, unsigned long max_bytes);
+
 int parlay_finalize(void);
 
 int parlay_register_font(const char* font_name, const char* normal_filename, const char* italic_filename,
         const char* bold_filename, const char* bold_italic_filename);
 
+int parlay_register_font_memory(const char* font_name, const void* normal_data, size_t normal_size,
+        const void* italic_data, size_t italic_size, const void* bold_data, size_t bold_size,
+        const void* bold_italic_data, size_t bold_italic_size);
+
+int parlay_register_mapped_font(const char* font_name, const char* normal_filename, const char* italic_filename,
+        const char* bold_filename, const char* bold_italic_filename);
+
+int parlay_unregister_font(const char* font_name);
+
+int parlay_get_font_handle(const char* font_name, ParlayFontHandle* rfont_handle);
+
+int parlay_set_font_fallbacks(const char* font_name, const char* const* fallback_names, int n_fallbacks);
+
+int parlay_preload_glyphs(const ParlayStyle* style, const ParlayCodepointRange* ranges, size_t n_ranges);
+
+int parlay_open_glyph_cache(const char* filename);
+
+int parlay_save_glyph_cache(void);
+
 int parlay_plain_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image);
 
 #if PARLAY_USE_MINIXML
 int parlay_markup_text(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayRGBARawImage* image);
 #endif
 
+int parlay_measure_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayTextMetrics* metrics);
+
+#if PARLAY_USE_MINIXML
+int parlay_measure_markup(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayTextMetrics* metrics);
+#endif
+
+int parlay_free_text_metrics(ParlayTextMetrics* metrics);
+
+int parlay_plain_text_to_target(const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        const ParlayRGBATarget* target, ParlayRGBARawImage* image);
+
+#if PARLAY_USE_MINIXML
+int parlay_markup_text_to_target(const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        const ParlayRGBATarget* target, ParlayRGBARawImage* image);
+#endif
+
+int parlay_render_batch(const ParlayBatchItem* items, size_t n_items, int n_threads, ParlayRGBARawImage* images,
+        int* statuses);
+
 int parlay_free_image_data(ParlayRGBARawImage* image);
 
+int parlay_style_defaults(ParlayStyle* style);
+
+int parlay_control_defaults(ParlayControl* ctl);
+
+int parlay_check_utf8(const char* text, size_t* roffset);
+
+int parlay_last_utf8_error(size_t* roffset);
+
+int parlay_atlas_new(int page_width, int page_height, int padding, ParlayAtlas** ratlas);
+
+int parlay_atlas_delete(ParlayAtlas* atlas);
+
+int parlay_atlas_get_page_count(const ParlayAtlas* atlas, int* rcount);
+
+int parlay_atlas_get_page(const ParlayAtlas* atlas, int page, ParlayRGBARawImage* image);
+
+int parlay_atlas_plain_text(ParlayAtlas* atlas, const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayAtlasEntry* entry);
+
+#if PARLAY_USE_MINIXML
+int parlay_atlas_markup_text(ParlayAtlas* atlas, const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayAtlasEntry* entry);
+#endif
+
+int parlay_layout_plain_text(const char* text, const ParlayStyle* style, const ParlayControl* ctl, ParlayLayout** rlayout);
+
+#if PARLAY_USE_MINIXML
+int parlay_layout_markup_text(const char* xml, const ParlayStyle* style, const ParlayControl* ctl, ParlayLayout** rlayout);
+#endif
+
+int parlay_layout_delete(ParlayLayout* layout);
+
+int parlay_layout_get_glyph_count(const ParlayLayout* layout, size_t* rcount);
+
+int parlay_layout_set_colors(ParlayLayout* layout, size_t first, size_t count, const float text_color[4],
+        const float border_color[4], const float highlight_color[4]);
+
+int parlay_layout_set_visible(ParlayLayout* layout, size_t first, size_t count, int visible);
+
+int parlay_layout_set_opacity(ParlayLayout* layout, float opacity);
+
+int parlay_layout_render(ParlayLayout* layout, const ParlayControl* ctl, ParlayRGBARawImage* image);
+
+int parlay_layout_render_to_target(ParlayLayout* layout, const ParlayControl* ctl, const ParlayRGBATarget* target,
+        ParlayRGBARawImage* image);
+
+int parlay_layout_render_update(ParlayLayout* layout, const ParlayLayout* previous, const ParlayControl* ctl,
+        ParlayRGBARawImage* image, ParlayRect* rects, size_t max_rects, size_t* rn_rects);
+
+int parlay_builder_new(const ParlayControl* ctl, ParlayParagraphBuilder** rbuilder);
+
+int parlay_builder_delete(ParlayParagraphBuilder* builder);
+
+int parlay_builder_append_text(ParlayParagraphBuilder* builder, const char* text, const ParlayStyle* style);
+
+int parlay_builder_render(ParlayParagraphBuilder* builder, ParlayRGBARawImage* image, int* rdirty_y, int* rdirty_height);
+
+int parlay_context_new(unsigned max_faces, unsigned max_sizes, unsigned long max_bytes, ParlayContext** rctx);
+
+int parlay_context_clone(const ParlayContext* src, ParlayContext** rctx);
+
+int parlay_context_delete(ParlayContext* ctx);
+
+int parlay_context_register_font(ParlayContext* ctx, const char* font_name, const char* normal_filename,
+        const char* italic_filename, const char* bold_filename, const char* bold_italic_filename);
+
+int parlay_context_register_font_memory(ParlayContext* ctx, const char* font_name, const void* normal_data,
+        size_t normal_size, const void* italic_data, size_t italic_size, const void* bold_data, size_t bold_size,
+        const void* bold_italic_data, size_t bold_italic_size);
+
+int parlay_context_register_mapped_font(ParlayContext* ctx, const char* font_name, const char* normal_filename,
+        const char* italic_filename, const char* bold_filename, const char* bold_italic_filename);
+
+int parlay_context_unregister_font(ParlayContext* ctx, const char* font_name);
+
+int parlay_context_get_font_handle(ParlayContext* ctx, const char* font_name, ParlayFontHandle* rfont_handle);
+
+int parlay_context_set_font_fallbacks(ParlayContext* ctx, const char* font_name, const char* const* fallback_names,
+        int n_fallbacks);
+
+int parlay_context_preload_glyphs(ParlayContext* ctx, const ParlayStyle* style, const ParlayCodepointRange* ranges,
+        size_t n_ranges);
+
+int parlay_context_open_glyph_cache(ParlayContext* ctx, const char* filename);
+
+int parlay_context_save_glyph_cache(ParlayContext* ctx);
+
+int parlay_context_plain_text(ParlayContext* ctx, const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayRGBARawImage* image);
+
+#if PARLAY_USE_MINIXML
+int parlay_context_markup_text(ParlayContext* ctx, const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayRGBARawImage* image);
+#endif
+
+int parlay_context_measure_text(ParlayContext* ctx, const char* text, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayTextMetrics* metrics);
+
+#if PARLAY_USE_MINIXML
+int parlay_context_measure_markup(ParlayContext* ctx, const char* xml, const ParlayStyle* style, const ParlayControl* ctl,
+        ParlayTextMetrics* metrics);
+#endif
+
+int parlay_context_plain_text_to_target(ParlayContext* ctx, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, const ParlayRGBATarget* target, ParlayRGBARawImage* image);
+
+#if PARLAY_USE_MINIXML
+int parlay_context_markup_text_to_target(ParlayContext* ctx, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, const ParlayRGBATarget* target, ParlayRGBARawImage* image);
+#endif
+
+int parlay_context_render_batch(ParlayContext* ctx, const ParlayBatchItem* items, size_t n_items, int n_threads,
+        ParlayRGBARawImage* images, int* statuses);
+
+int parlay_context_atlas_plain_text(ParlayContext* ctx, ParlayAtlas* atlas, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayAtlasEntry* entry);
+
+#if PARLAY_USE_MINIXML
+int parlay_context_atlas_markup_text(ParlayContext* ctx, ParlayAtlas* atlas, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayAtlasEntry* entry);
+#endif
+
+int parlay_context_layout_plain_text(ParlayContext* ctx, const char* text, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayLayout** rlayout);
+
+#if PARLAY_USE_MINIXML
+int parlay_context_layout_markup_text(ParlayContext* ctx, const char* xml, const ParlayStyle* style,
+        const ParlayControl* ctl, ParlayLayout** rlayout);
+#endif
+
+int parlay_context_builder_new(ParlayContext* ctx, const ParlayControl* ctl, ParlayParagraphBuilder** rbuilder);
+
+int parlay_context_last_utf8_error(const ParlayContext* ctx, size_t* roffset);
+
 #endif
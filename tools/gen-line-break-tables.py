@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+
+# tools/gen-line-break-tables.py
+#
+# Generates section two of parlay-unicode.h, the line breaking tables, from
+# LineBreak.txt in the Unicode Character Database.  Run it with the path to
+# LineBreak.txt and it writes the section to standard output, from its
+# heading to the end of line_break_pairs, ready to replace the old one:
+#
+#   python3 tools/gen-line-break-tables.py LineBreak.txt > section.txt
+#
+# The classes are resolved as UAX #14 rule LB1 says before they go in the
+# tables, and the pair table is worked out from rules LB7 through LB31.  If
+# you regenerate from a newer LineBreak.txt, update the version in the
+# comment below, and check whether the rules have changed too.  The class
+# numbers have to match the LB_* constants in parlay-internal.h.
+
+import re
+import sys
+
+UNICODE_VERSION = '14.0'
+
+# The order of the LB_* constants.  The first 33 are the ones the pair table
+# covers; SP and BK are handled by the line breaking code itself.
+CLASSES = ['OP', 'CL', 'CP', 'QU', 'GL', 'NS', 'EX', 'SY', 'IS', 'PR', 'PO', 'NU', 'AL', 'HL', 'ID', 'IN',
+           'HY', 'BA', 'BB', 'B2', 'ZW', 'CM', 'WJ', 'H2', 'H3', 'JL', 'JV', 'JT', 'RI', 'EB', 'EM', 'ZWJ',
+           'CB', 'SP', 'BK']
+PAIR_CLASSES = CLASSES[:CLASSES.index('CB')+1]
+
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+N_CODEPOINTS = 0x110000
+
+# The white space characters in BA, which break like spaces
+SPACES = {0x09, 0x0B, 0x0C, 0x20, 0x85, 0xA0, 0x1680, 0x2028, 0x2029, 0x202F, 0x205F, 0x3000}
+SPACES |= set(range(0x2000, 0x200B))
+
+LB_DIRECT, LB_INDIRECT, LB_PROHIBITED = 0, 1, 2
+
+
+def parse_range(text):
+    first, _, last = text.strip().partition('..')
+    return int(first, 16), int(last or first, 16)
+
+
+# Reads the class and general category of every code point.  Code points
+# that aren't listed get the class from the @missing lines, which later
+# versions of the file use for the ranges that default to something besides
+# XX; the general category is only needed for SA, which is always listed.
+
+def read_line_break(filename):
+    classes = ['XX'] * N_CODEPOINTS
+    categories = [None] * N_CODEPOINTS
+    listed = []
+    missing = re.compile(r'#\s*@missing:\s*([0-9A-Fa-f.]+)\s*;\s*(\w+)')
+
+    with open(filename, encoding='utf-8') as f:
+        for line in f:
+            m = missing.match(line)
+            if m:
+                first, last = parse_range(m.group(1))
+                classes[first:last+1] = [m.group(2)] * (last+1-first)
+                continue
+            data, _, comment = line.partition('#')
+            if not data.strip():
+                continue
+            codepoints, cls = data.split(';')
+            first, last = parse_range(codepoints)
+            category = comment.split()[0] if comment.strip() else None
+            listed.append((first, last, cls.strip(), category))
+
+    for first, last, cls, category in listed:
+        classes[first:last+1] = [cls] * (last+1-first)
+        categories[first:last+1] = [category] * (last+1-first)
+    return classes, categories
+
+
+# Rule LB1, plus folding the mandatory breaks together and the white space
+# in BA into SP
+
+def resolve(classes, categories):
+    for c in range(N_CODEPOINTS):
+        cls = classes[c]
+        if cls in ('AI', 'SG', 'XX'):
+            cls = 'AL'
+        elif cls == 'SA':
+            cls = 'CM' if categories[c] in ('Mn', 'Mc') else 'AL'
+        elif cls == 'CJ':
+            cls = 'NS'
+        elif cls in ('CR', 'LF', 'NL', 'BK'):
+            cls = 'BK'
+        elif cls == 'BA' and c in SPACES:
+            cls = 'SP'
+        if cls not in CLASSES:
+            sys.exit('U+%04X has class %s, which Parlay has no constant for' % (c, cls))
+        classes[c] = cls
+
+
+# Splits the classes into blocks, storing each different block once
+
+def build_blocks(classes):
+    index = []
+    blocks = []
+    seen = {}
+    for start in range(0, N_CODEPOINTS, BLOCK_SIZE):
+        block = tuple(CLASSES.index(cls) for cls in classes[start:start+BLOCK_SIZE])
+        if block not in seen:
+            seen[block] = len(blocks)
+            blocks.append(block)
+        index.append(seen[block])
+    if len(blocks) > 256:
+        sys.exit('%d blocks is too many for line_break_index' % len(blocks))
+    return index, blocks
+
+
+# Whether a line can break between a and b with nothing between them, by
+# rules LB7 through LB31 in order
+
+def can_break_directly(a, b):
+    if b == 'ZW':
+        return False
+    if a == 'ZW':
+        return True
+    if b in ('CM', 'ZWJ'):
+        return False
+    if a == 'ZWJ':
+        return False
+    if b == 'WJ' or a == 'WJ':
+        return False
+    if a == 'GL':
+        return False
+    if b == 'GL' and a not in ('BA', 'HY'):
+        return False
+    if b in ('CL', 'CP', 'EX', 'IS', 'SY'):
+        return False
+    if a == 'OP':
+        return False
+    if a == 'QU' and b == 'OP':
+        return False
+    if a in ('CL', 'CP') and b == 'NS':
+        return False
+    if a == 'B2' and b == 'B2':
+        return False
+    if b == 'QU' or a == 'QU':
+        return False
+    if b == 'CB' or a == 'CB':
+        return True
+    if b in ('BA', 'HY', 'NS') or a == 'BB':
+        return False
+    if a == 'SY' and b == 'HL':
+        return False
+    if b == 'IN':
+        return False
+    if a in ('AL', 'HL', 'CM') and b == 'NU':
+        return False
+    if a == 'NU' and b in ('AL', 'HL'):
+        return False
+    if a == 'PR' and b in ('ID', 'EB', 'EM'):
+        return False
+    if a in ('ID', 'EB', 'EM') and b == 'PO':
+        return False
+    if a in ('PR', 'PO') and b in ('AL', 'HL'):
+        return False
+    if a in ('AL', 'HL', 'CM') and b in ('PR', 'PO'):
+        return False
+    if (a, b) in (('CL', 'PO'), ('CL', 'PR'), ('CP', 'PO'), ('CP', 'PR'), ('NU', 'PO'), ('NU', 'PR'),
+                  ('PO', 'OP'), ('PR', 'OP'), ('PO', 'NU'), ('PR', 'NU'), ('HY', 'NU'), ('IS', 'NU'),
+                  ('NU', 'NU'), ('SY', 'NU')):
+        return False
+    if a == 'JL' and b in ('JL', 'JV', 'H2', 'H3'):
+        return False
+    if a in ('JV', 'H2') and b in ('JV', 'JT'):
+        return False
+    if a in ('JT', 'H3') and b == 'JT':
+        return False
+    if a in ('JL', 'JV', 'JT', 'H2', 'H3') and b == 'PO':
+        return False
+    if a == 'PR' and b in ('JL', 'JV', 'JT', 'H2', 'H3'):
+        return False
+    if a in ('AL', 'HL', 'CM') and b in ('AL', 'HL'):
+        return False
+    if a == 'IS' and b in ('AL', 'HL'):
+        return False
+    if a in ('AL', 'HL', 'NU', 'CM') and b == 'OP':
+        return False
+    if a == 'CP' and b in ('AL', 'HL', 'NU'):
+        return False
+    if a == 'RI' and b == 'RI':
+        return False
+    if a == 'EB' and b == 'EM':
+        return False
+    return True
+
+
+# Whether a line can break between a and b with spaces between them; only
+# the rules that look past spaces can stop it
+
+def can_break_after_spaces(a, b):
+    if b == 'ZW':
+        return False
+    if a == 'ZW':
+        return True
+    if b in ('CM', 'ZWJ'):
+        return False
+    if b == 'WJ':
+        return False
+    if b in ('CL', 'CP', 'EX', 'IS', 'SY'):
+        return False
+    if a == 'OP':
+        return False
+    if a == 'QU' and b == 'OP':
+        return False
+    if a in ('CL', 'CP') and b == 'NS':
+        return False
+    if a == 'B2' and b == 'B2':
+        return False
+    return True
+
+
+def pair_value(a, b):
+    if can_break_directly(a, b):
+        return LB_DIRECT
+    return LB_INDIRECT if can_break_after_spaces(a, b) else LB_PROHIBITED
+
+
+def emit(index, blocks):
+    out = []
+    out.append('/* -------- Section two: Line breaking classes -------- */\n')
+    out.append('''/* The line breaking class of every code point, from LineBreak.txt in the
+   Unicode Character Database, version %s, split into blocks of 128 code
+   points.  line_break_index gives the block for each run of 128 code points,
+   and line_break_blocks holds the blocks, each stored once, so a lookup is
+   two loads.  The classes have already been resolved as UAX #14 rule LB1
+   says: AI, SG, and XX are AL, CJ is NS, and SA is CM for marks and AL for
+   everything else.  CR, LF, and NL are listed as BK, and the white space
+   characters in BA (tab, the fixed width spaces, and so on) as SP. */
+
+static const unsigned char line_break_index[0x110000 >> %d] = {''' % (UNICODE_VERSION, BLOCK_SHIFT))
+    rows = []
+    for i in range(0, len(index), 16):
+        rows.append('    ' + ','.join('%3d' % x for x in index[i:i+16]))
+    out.append(',\n'.join(rows) + '\n};\n')
+
+    out.append('static const unsigned char line_break_blocks[%d][%d] = {' % (len(blocks), BLOCK_SIZE))
+    block_texts = []
+    for block in blocks:
+        rows = []
+        for i in range(0, BLOCK_SIZE, 32):
+            rows.append('    ' + ','.join('%d' % x for x in block[i:i+32]))
+        block_texts.append('  {\n' + ',\n'.join(rows) + '\n  }')
+    out.append(',\n'.join(block_texts) + '\n};\n')
+
+    out.append('''/* Whether a line can break between two characters, by their line breaking
+   classes (rules LB7 through LB31 of UAX #14), indexed by the class before
+   and the class after.  LB_DIRECT means it can; LB_INDIRECT means only if
+   spaces come between them; LB_PROHIBITED means it can't, even with spaces
+   between.  The columns are in the same order as the rows.  Rule LB21a and
+   the East Asian width condition of LB30 are ignored, and regional
+   indicators are never split. */
+
+static const unsigned char line_break_pairs[LB_CB+1][LB_CB+1] = {''')
+    rows = []
+    for a in PAIR_CLASSES:
+        rows.append('    /* %-3s */ {' % a + ','.join('%d' % pair_value(a, b) for b in PAIR_CLASSES) + '}')
+    out.append(',\n'.join(rows) + '\n};\n')
+    return '\n'.join(out)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: %s LineBreak.txt' % sys.argv[0])
+    classes, categories = read_line_break(sys.argv[1])
+    resolve(classes, categories)
+    index, blocks = build_blocks(classes)
+    sys.stdout.write(emit(index, blocks))
+
+
+if __name__ == '__main__':
+    main()